@@ -1,10 +1,46 @@
 #include <iostream>
 #include <chrono>
 #include <iomanip>
+#include <optional>
+#include <random>
 #include <string>
+#include <vector>
 #include "charted/charted.hpp"
 #include "charted_json/charted_json.hpp"
 
+namespace
+{
+    // Builds route-like strings of at least minLength bytes.
+    std::vector<std::string> GenerateRoutes(std::size_t count, std::size_t minLength)
+    {
+        std::mt19937 rng(20240601u);
+        std::vector<std::string> routes;
+        routes.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::string path;
+            while (path.size() < minLength)
+            {
+                if (!path.empty())
+                {
+                    path += '.';
+                }
+                const std::size_t keyLength = 1 + rng() % 14;
+                for (std::size_t k = 0; k < keyLength; ++k)
+                {
+                    path += static_cast<char>('a' + rng() % 26);
+                }
+                if (rng() % 3 == 0)
+                {
+                    path += '[' + std::to_string(rng() % 1000) + ']';
+                }
+            }
+            routes.push_back(std::move(path));
+        }
+        return routes;
+    }
+}
+
 int main()
 {
     std::cout << "=== Quick Start ===\n";
@@ -52,10 +88,19 @@ int main()
     {
         std::cout << "Parse() demo, hello = " << parsed->Get<std::string>("hello", "none") << '\n';
     }
+    if (const auto rejected = charted::Json::TryParse(R"({"hello":"world",})"); !rejected.IsOk())
+    {
+        std::cout << "TryParse() demo, error kind " << static_cast<int>(rejected.Error.Kind) << " at byte "
+                  << rejected.Error.Offset << '\n';
+    }
 
     auto long_dynamic_route = charted::route("Root.Config.System.Modules[3].Pipelines[2].Stages[4].Name");
+    const charted::PackedRoute long_packed_route("Root.Config.System.Modules[3].Pipelines[2].Stages[4].Name");
+    const charted::CompactRoute long_compact_route("Root.Config.System.Modules[3].Pipelines[2].Stages[4].Name");
     const auto& long_static_route =
         charted::route<"Root.Config.System.Modules[3].Pipelines[2].Stages[4].Name">();
+    constexpr auto long_route_template =
+        charted::route<"Root.Config.System.Modules[$].Pipelines[$].Stages[$].Name">();
     json.Set(long_dynamic_route, "Stage-Name");
 
     json.Set("Flat", 123);
@@ -105,10 +150,62 @@ int main()
     {
         return static_cast<int>(json.Get<std::string>(long_dynamic_route, "missing").size());
     });
+    // Borrowed reads: a string too long for SSO, copied out vs viewed in place.
+    const auto log_message_route = charted::route("Root.Config.System.Log.Message");
+    json.Set(log_message_route, std::string(64, 'm'));
+    const double ns_string_copy = benchmark_ns_per_op([&]()
+    {
+        return static_cast<int>(json.Get<std::string>(log_message_route, "missing").size());
+    });
+    const double ns_string_view = benchmark_ns_per_op([&]()
+    {
+        return static_cast<int>(json.Get<std::string_view>(log_message_route, "missing").size());
+    });
+    const double ns_string_pointer = benchmark_ns_per_op([&]()
+    {
+        const std::string* text = json.Get<const std::string*>(log_message_route, nullptr);
+        return text != nullptr ? static_cast<int>(text->size()) : 0;
+    });
+    // Extraction into a reused buffer: the string and the vector keep their capacity across calls.
+    const auto samples_route = charted::route("Root.Config.System.Samples");
+    json.Set(samples_route, std::vector<int>(32, 7));
+    std::string message_buffer;
+    std::vector<int> samples_buffer;
+    const double ns_string_get_into = benchmark_ns_per_op([&]()
+    {
+        return json.GetInto(log_message_route, message_buffer) ? static_cast<int>(message_buffer.size()) : 0;
+    });
+    const double ns_vector_get = benchmark_ns_per_op([&]()
+    {
+        return static_cast<int>(json.Get<std::vector<int>>(samples_route).size());
+    });
+    const double ns_vector_get_into = benchmark_ns_per_op([&]()
+    {
+        return json.GetInto(samples_route, samples_buffer) ? static_cast<int>(samples_buffer.size()) : 0;
+    });
     const double ns_long_static_route = benchmark_ns_per_op([&]()
     {
         return static_cast<int>(json.Get<std::string>(long_static_route, "missing").size());
     });
+    const auto   long_bound_handle    = json.Bind(long_packed_route);
+    const double ns_long_bound_handle = benchmark_ns_per_op([&]()
+    {
+        return static_cast<int>(long_bound_handle.Get<std::string>("missing").size());
+    });
+    const double ns_long_packed_route = benchmark_ns_per_op([&]()
+    {
+        return static_cast<int>(json.Get<std::string>(long_packed_route, "missing").size());
+    });
+    const double ns_long_compact_route = benchmark_ns_per_op([&]()
+    {
+        return static_cast<int>(json.Get<std::string>(long_compact_route, "missing").size());
+    });
+    volatile std::uint32_t module_index = 3;
+    const double ns_long_bound_route = benchmark_ns_per_op([&]()
+    {
+        const auto bound = long_route_template(module_index, 2u, 4u);
+        return static_cast<int>(json.Get<std::string>(bound, "missing").size());
+    });
     const double ns_long_native_chained = benchmark_ns_per_op([&]()
     {
         const auto& native = json.GetNative();
@@ -118,6 +215,24 @@ int main()
                 .size());
     });
 
+    // Counter increment: TryGet followed by Set walks the path twice; Update walks it once.
+    const auto counter_route = charted::route("Root.Config.System.Modules[3].Pipelines[2].Stages[4].Hits");
+    json.Set(counter_route, 0);
+    const double ns_increment_get_set = benchmark_ns_per_op([&]()
+    {
+        const int hits = json.TryGet<int>(counter_route).value_or(0) + 1;
+        json.Set(counter_route, hits);
+        return hits;
+    });
+    const double ns_increment_update = benchmark_ns_per_op([&]()
+    {
+        int hits = 0;
+        json.Update(counter_route, [&](auto& node) { node = hits = (node.is_number() ? node.template get<int>() : 0) + 1; });
+        return hits;
+    });
+    // Schema drift: the field holds a string, the reader asks for an int and falls back to the default.
+    const double ns_type_mismatch = benchmark_ns_per_op([&]() { return json.Get<int>(long_dynamic_route, -1); });
+
     const auto parse_start = clock::now();
     for (std::size_t i = 0; i < parse_iterations; ++i)
     {
@@ -128,6 +243,215 @@ int main()
     const auto parse_total_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(parse_end - parse_start).count();
     const double ns_dynamic_parse = static_cast<double>(parse_total_ns) / static_cast<double>(parse_iterations);
 
+    constexpr std::string_view long_route_text = "Root.Config.System.Modules[3].Pipelines[2].Stages[4].Name";
+    const auto long_parse_start = clock::now();
+    for (std::size_t i = 0; i < parse_iterations; ++i)
+    {
+        auto parsed = charted::route(long_route_text);
+        sink += static_cast<int>(parsed.GetTokenCount());
+    }
+    const auto long_parse_end = clock::now();
+    const auto long_parse_total_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(long_parse_end - long_parse_start).count();
+    const double ns_long_dynamic_parse = static_cast<double>(long_parse_total_ns) / static_cast<double>(parse_iterations);
+
+    const auto generated_routes = GenerateRoutes(256, 120);
+    std::vector<charted::RouteToken> generated_tokens;
+    generated_tokens.reserve(64);
+    auto measure_generated_parse = [&](auto&& parse) -> double
+    {
+        const auto start = clock::now();
+        for (std::size_t i = 0; i < parse_iterations; ++i)
+        {
+            sink += static_cast<int>(parse(generated_routes[i % generated_routes.size()], generated_tokens));
+        }
+        const auto total_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count();
+        return static_cast<double>(total_ns) / static_cast<double>(parse_iterations);
+    };
+    const double ns_generated_parse = measure_generated_parse([](std::string_view path, auto& tokens)
+    {
+        return charted::detail::ParseDynamicRoute(path, tokens);
+    });
+
+    charted::RouteCache route_cache(4096, true);
+    const auto cache_start = clock::now();
+    for (std::size_t i = 0; i < parse_iterations; ++i)
+    {
+        const auto cached = route_cache.Get(long_route_text);
+        sink += static_cast<int>(cached->GetTokenCount());
+    }
+    const auto cache_end = clock::now();
+    const auto cache_total_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(cache_end - cache_start).count();
+    const double ns_cached_route = static_cast<double>(cache_total_ns) / static_cast<double>(parse_iterations);
+
+    // A config loader reading 64 settings under one module: separate Get calls vs one GetMany pass.
+    charted::Json config;
+    std::vector<charted::DynamicRoute> setting_routes;
+    for (int i = 0; i < 64; ++i)
+    {
+        setting_routes.emplace_back(
+            "Root.Config.System.Modules[3].Settings.Key" + std::to_string(i));
+        config.Set(setting_routes.back(), i);
+    }
+    std::vector<std::optional<int>> setting_values(setting_routes.size());
+    constexpr std::size_t batch_iterations = parse_iterations / 10;
+    const auto separate_start = clock::now();
+    for (std::size_t i = 0; i < batch_iterations; ++i)
+    {
+        for (std::size_t r = 0; r < setting_routes.size(); ++r)
+        {
+            setting_values[r] = config.TryGet<int>(setting_routes[r]);
+        }
+        sink += setting_values.back().value_or(0);
+    }
+    const auto separate_total_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - separate_start).count();
+    const double ns_separate_batch = static_cast<double>(separate_total_ns) / static_cast<double>(batch_iterations);
+    const auto many_start = clock::now();
+    for (std::size_t i = 0; i < batch_iterations; ++i)
+    {
+        sink += static_cast<int>(config.GetMany(setting_routes, setting_values));
+    }
+    const auto many_total_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - many_start).count();
+    const double ns_many_batch = static_cast<double>(many_total_ns) / static_cast<double>(batch_iterations);
+    // Reading the same 64 settings as a section: copying it out with TryGet<Json> vs a JsonConstRef view.
+    const auto settings_route = charted::route("Root.Config.System.Modules[3].Settings");
+    std::vector<std::string> setting_keys;
+    for (int i = 0; i < 64; ++i)
+    {
+        setting_keys.push_back("Key" + std::to_string(i));
+    }
+    const charted::Json& config_view = config;
+    const auto section_copy_start = clock::now();
+    for (std::size_t i = 0; i < batch_iterations; ++i)
+    {
+        const auto section = config_view.TryGet<charted::Json>(settings_route);
+        for (const std::string& key : setting_keys)
+        {
+            sink += section->Get<int>(key, 0);
+        }
+    }
+    const auto section_copy_total_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - section_copy_start).count();
+    const double ns_section_copy = static_cast<double>(section_copy_total_ns) / static_cast<double>(batch_iterations);
+    const auto section_view_start = clock::now();
+    for (std::size_t i = 0; i < batch_iterations; ++i)
+    {
+        const auto section = config_view.At(settings_route);
+        for (const std::string& key : setting_keys)
+        {
+            sink += section.Get<int>(key, 0);
+        }
+    }
+    const auto section_view_total_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - section_view_start).count();
+    const double ns_section_view = static_cast<double>(section_view_total_ns) / static_cast<double>(batch_iterations);
+    // Building a 10k-field response document: repeated Set, one SetMany, and hand-written nlohmann.
+    std::vector<charted::DynamicRoute> record_routes;
+    std::vector<std::string>           record_keys;
+    std::vector<int>                   record_values;
+    for (int k = 0; k < 10; ++k)
+    {
+        record_keys.push_back("Field" + std::to_string(k));
+    }
+    for (int i = 0; i < 1000; ++i)
+    {
+        for (int k = 0; k < 10; ++k)
+        {
+            record_routes.emplace_back("Response.Records[" + std::to_string(i) + "]." + record_keys[k]);
+            record_values.push_back(i * 10 + k);
+        }
+    }
+    constexpr std::size_t build_iterations = 20;
+    auto measure_build_us = [&](auto&& build) -> double
+    {
+        const auto start = clock::now();
+        for (std::size_t i = 0; i < build_iterations; ++i)
+        {
+            sink += build();
+        }
+        const auto total_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count();
+        return static_cast<double>(total_ns) / static_cast<double>(build_iterations) / 1000.0;
+    };
+    // Reshaping: relocate a 10k-field subtree between two routes by copy vs by Take + rvalue Set.
+    charted::Json reshape;
+    reshape.SetMany(record_routes, record_values);
+    const auto reshape_from = charted::route("Response");
+    const auto reshape_to   = charted::route("Archive.Response");
+    const double us_reshape_move = measure_build_us([&]()
+    {
+        reshape.Set(reshape_to, reshape.Take<charted::Json>(reshape_from).value());
+        reshape.Set(reshape_from, reshape.Take<charted::Json>(reshape_to).value());
+        return 0;
+    });
+    const double us_reshape_copy = measure_build_us([&]()
+    {
+        reshape.Set(reshape_to, reshape.TryGet<charted::Json>(reshape_from).value());
+        reshape.Set(reshape_from, reshape.TryGet<charted::Json>(reshape_to).value());
+        return 0;
+    });
+
+    // Rejecting malformed input: nlohmann's throwing parse caught at the call site vs the non-throwing paths.
+    const std::string_view malformed_text = R"({"Root":{"Modules":[1,2,3],"Name":"Stage",}})";
+    auto measure_reject_ns = [&](auto&& parse) -> double
+    {
+        const auto start = clock::now();
+        for (std::size_t i = 0; i < parse_iterations; ++i)
+        {
+            sink += parse() ? 1 : 0;
+        }
+        const auto total_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count();
+        return static_cast<double>(total_ns) / static_cast<double>(parse_iterations);
+    };
+    const double ns_reject_parse     = measure_reject_ns([&]() { return charted::Json::Parse(malformed_text).has_value(); });
+    const double ns_reject_try_parse = measure_reject_ns([&]() { return charted::Json::TryParse(malformed_text).IsOk(); });
+#if CHARTED_HAS_EXCEPTIONS
+    const double ns_reject_throwing = measure_reject_ns([&]()
+    {
+        try
+        {
+            return !nlohmann::json::parse(malformed_text).is_discarded();
+        }
+        catch (const nlohmann::json::parse_error&)
+        {
+            return false;
+        }
+    });
+#else
+    // Without exceptions there is no throwing path to compare against.
+    const double ns_reject_throwing = ns_reject_parse;
+#endif
+
+    const double us_build_set = measure_build_us([&]()
+    {
+        charted::Json document;
+        for (std::size_t i = 0; i < record_routes.size(); ++i)
+        {
+            document.Set(record_routes[i], record_values[i]);
+        }
+        return static_cast<int>(document.GetNative().size());
+    });
+    const double us_build_set_many = measure_build_us([&]()
+    {
+        charted::Json document;
+        document.SetMany(record_routes, record_values);
+        return static_cast<int>(document.GetNative().size());
+    });
+    const double us_build_native = measure_build_us([&]()
+    {
+        nlohmann::json document;
+        auto& records = document["Response"]["Records"];
+        for (int i = 0; i < 1000; ++i)
+        {
+            auto& record = records[static_cast<std::size_t>(i)];
+            for (int k = 0; k < 10; ++k)
+            {
+                record[record_keys[k]] = i * 10 + k;
+            }
+        }
+        return static_cast<int>(document.size());
+    });
+
     std::cout << "\n=== Benchmark (lower is better) ===\n";
     std::cout << "Iterations: " << iterations << '\n';
     std::cout << "Note: benchmark uses flat key \"Flat\" to isolate access overhead.\n";
@@ -141,6 +465,11 @@ int main()
               << (ns_native_find_get / ns_get_key) << ")\n";
     std::cout << "Dynamic route compile      : " << ns_dynamic_parse << " ns/op (" << parse_iterations
               << " iterations, expression -> tokens)\n";
+    std::cout << "Long route compile         : " << ns_long_dynamic_parse << " ns/op (" << parse_iterations
+              << " iterations, long route expression)\n";
+    std::cout << "Generated 120B+ routes     : " << ns_generated_parse << " ns/op\n";
+    std::cout << "RouteCache lookup (long)   : " << ns_cached_route << " ns/op (" << route_cache.GetHitCount()
+              << " hits, " << route_cache.GetMissCount() << " misses)\n";
 
     std::cout << "\n=== Benchmark: Deep path A.B[2].C (lower is better) ===\n";
     std::cout << "Json::Get(dynamic route)   : " << ns_deep_dynamic_route << " ns/op (x1.00)\n";
@@ -153,8 +482,68 @@ int main()
     std::cout << "Json::Get(dynamic route)   : " << ns_long_dynamic_route << " ns/op (x1.00)\n";
     std::cout << "Json::Get(static route)    : " << ns_long_static_route << " ns/op (x"
               << (ns_long_static_route / ns_long_dynamic_route) << ")\n";
+    std::cout << "BoundRoute::Get (cached)   : " << ns_long_bound_handle << " ns/op (x"
+              << (ns_long_bound_handle / ns_long_dynamic_route) << ")\n";
+    std::cout << "Json::Get(packed route)    : " << ns_long_packed_route << " ns/op (x"
+              << (ns_long_packed_route / ns_long_dynamic_route) << ")\n";
+    std::cout << "Json::Get(compact route)   : " << ns_long_compact_route << " ns/op (x"
+              << (ns_long_compact_route / ns_long_dynamic_route) << ")\n";
+    std::cout << "Json::Get(bound [$] route) : " << ns_long_bound_route << " ns/op (x"
+              << (ns_long_bound_route / ns_long_dynamic_route) << ")\n";
+    std::cout << "Increment via TryGet+Set   : " << ns_increment_get_set << " ns/op (x"
+              << (ns_increment_get_set / ns_long_dynamic_route) << ")\n";
+    std::cout << "Increment via Update       : " << ns_increment_update << " ns/op (x"
+              << (ns_increment_update / ns_long_dynamic_route) << ")\n";
+    std::cout << "Get<int> on string field   : " << ns_type_mismatch << " ns/op (x"
+              << (ns_type_mismatch / ns_long_dynamic_route) << ")\n";
     std::cout << "Native nlohmann chained    : " << ns_long_native_chained << " ns/op (x"
               << (ns_long_native_chained / ns_long_dynamic_route) << ")\n";
 
+    std::cout << "\n=== Benchmark: string and vector reads under Root.Config.System (lower is better) ===\n";
+    std::cout << "Json::Get<std::string>     : " << ns_string_copy << " ns/op (x1.00)\n";
+    std::cout << "Json::Get<std::string_view>: " << ns_string_view << " ns/op (x"
+              << (ns_string_view / ns_string_copy) << ")\n";
+    std::cout << "Json::Get<const string*>   : " << ns_string_pointer << " ns/op (x"
+              << (ns_string_pointer / ns_string_copy) << ")\n";
+
+    std::cout << "Json::GetInto(std::string) : " << ns_string_get_into << " ns/op (x"
+              << (ns_string_get_into / ns_string_copy) << ")\n";
+    std::cout << "Json::Get<vector<int>> (32): " << ns_vector_get << " ns/op (x1.00)\n";
+    std::cout << "Json::GetInto(vector<int>) : " << ns_vector_get_into << " ns/op (x"
+              << (ns_vector_get_into / ns_vector_get) << ")\n";
+
+    std::cout << "\n=== Benchmark: 64 routes under Root.Config.System.Modules[3].Settings ===\n";
+    std::cout << "Separate Json::TryGet      : " << ns_separate_batch << " ns/batch (x1.00)\n";
+    std::cout << "Json::GetMany              : " << ns_many_batch << " ns/batch (x"
+              << (ns_many_batch / ns_separate_batch) << ")\n";
+    std::cout << "Section copy (TryGet<Json>): " << ns_section_copy << " ns/batch (x"
+              << (ns_section_copy / ns_separate_batch) << ")\n";
+    std::cout << "Section view (At)          : " << ns_section_view << " ns/batch (x"
+              << (ns_section_view / ns_separate_batch) << ")\n";
+
+    std::cout << "\n=== Benchmark: build 10k-field document (lower is better) ===\n";
+    std::cout << "Repeated Json::Set         : " << us_build_set << " us/doc (x1.00)\n";
+    std::cout << "Json::SetMany              : " << us_build_set_many << " us/doc (x"
+              << (us_build_set_many / us_build_set) << ")\n";
+    std::cout << "Hand-written nlohmann      : " << us_build_native << " us/doc (x"
+              << (us_build_native / us_build_set) << ")\n";
+
+    std::cout << "Relocate subtree by copy   : " << us_reshape_copy << " us/op\n";
+    std::cout << "Relocate via Take + Set    : " << us_reshape_move << " us/op\n";
+
+    std::cout << "\n=== Benchmark: reject malformed JSON (lower is better) ===\n";
+#if CHARTED_HAS_EXCEPTIONS
+    std::cout << "nlohmann parse + catch     : " << ns_reject_throwing << " ns/op (x1.00)\n";
+#endif
+    std::cout << "Json::Parse                : " << ns_reject_parse << " ns/op (x"
+              << (ns_reject_parse / ns_reject_throwing) << ")\n";
+    std::cout << "Json::TryParse (with error): " << ns_reject_try_parse << " ns/op (x"
+              << (ns_reject_try_parse / ns_reject_throwing) << ")\n";
+
+    std::cout << "\n=== Route footprint (bytes per handle) ===\n";
+    std::cout << "DynamicRoute               : " << sizeof(charted::DynamicRoute) << '\n';
+    std::cout << "PackedRoute                : " << sizeof(charted::PackedRoute) << '\n';
+    std::cout << "CompactRoute               : " << sizeof(charted::CompactRoute) << '\n';
+
     return 0;
 }
\ No newline at end of file
@@ -1,6 +1,11 @@
 #pragma once
+#include <string>
 #include <string_view>
+#include <utility>
 #include "route/charted_route.hpp"
+#include "route/charted_route_builder.hpp"
+#include "route/charted_route_cache.hpp"
+#include "route/charted_route_compact.hpp"
 
 namespace charted
 {
@@ -9,6 +14,17 @@ namespace charted
         return DynamicRoute(path);
     }
 
+    [[nodiscard]] inline DynamicRoute route(const char* path)
+    {
+        return DynamicRoute(path);
+    }
+
+    // Adopts an rvalue std::string instead of copying it; lvalues go through the string_view overload.
+    [[nodiscard]] inline DynamicRoute route(std::string&& path)
+    {
+        return DynamicRoute(std::move(path));
+    }
+
     template <StringLiteral Path>
     [[nodiscard]] constexpr auto route()
     {
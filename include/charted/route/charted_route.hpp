@@ -1,13 +1,33 @@
 #pragma once
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <concepts>
+#include <memory>
+#include <new>
 #include <memory_resource>
 #include <span>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
+#include <vector>
+
+// Selects the SSE2 delimiter scanner for dynamic routes. Define as 0 to use the portable SWAR scanner instead.
+#ifndef CHARTED_HAS_SSE2
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define CHARTED_HAS_SSE2 1
+    #else
+        #define CHARTED_HAS_SSE2 0
+    #endif
+#endif
+
+#if CHARTED_HAS_SSE2
+#include <emmintrin.h>
+#endif
 
 namespace charted
 {
@@ -24,16 +44,104 @@ namespace charted
         RouteTokenType   Type  { RouteTokenType::Key };
         std::uint32_t    Index { 0 };
 
-        [[nodiscard]] std::string_view GetString() const noexcept
+        [[nodiscard]] constexpr std::string_view GetString() const noexcept
         {
             return (Ptr != nullptr && Length > 0)
                 ? std::string_view(Ptr, static_cast<std::size_t>(Length))
                 : std::string_view{};
         }
+
+        // Compares route segments, rejecting mismatched keys by length before touching text.
+        [[nodiscard]] constexpr bool operator==(const RouteToken& other) const noexcept
+        {
+            if (Type != other.Type)
+            {
+                return false;
+            }
+            if (Type == RouteTokenType::Index)
+            {
+                return Index == other.Index;
+            }
+            return Length == other.Length && GetString() == other.GetString();
+        }
     };
 
     static_assert(sizeof(RouteToken) == 16, "RouteToken expected to be 16 bytes.");
 
+    namespace detail
+    {
+        // Little-endian load of Size bytes; a plain memcpy at runtime, byte assembly during constant evaluation.
+        template <std::size_t Size>
+        [[nodiscard]] constexpr std::uint64_t LoadRouteWord(const char* data) noexcept
+        {
+            if (!std::is_constant_evaluated() && std::endian::native == std::endian::little)
+            {
+                std::conditional_t<Size == 8, std::uint64_t, std::uint32_t> word = 0;
+                std::memcpy(&word, data, Size);
+                return word;
+            }
+
+            std::uint64_t word = 0;
+            for (std::size_t i = 0; i < Size; ++i)
+            {
+                word |= static_cast<std::uint64_t>(static_cast<unsigned char>(data[i])) << (8 * i);
+            }
+            return word;
+        }
+    } // namespace detail
+
+    // Relocatable 8-byte token encoding. Text is addressed by an offset into the owning route's path,
+    // so a table of packed tokens stays valid when the path is copied or moved. Value holds the index
+    // of an index token and is 0 for a key token.
+    struct PackedRouteToken
+    {
+        static constexpr std::size_t   MaxOffset = 0xFFFF;
+        static constexpr std::size_t   MaxLength = 0x7FFF;
+        static constexpr std::uint16_t IndexFlag = 0x8000;
+
+        std::uint16_t Offset       { 0 };
+        std::uint16_t LengthAndType{ 0 }; // Low 15 bits: length. High bit: set for index tokens.
+        std::uint32_t Value        { 0 };
+
+        [[nodiscard]] static constexpr bool CanPack(const RouteToken& token, const char* base) noexcept
+        {
+            return static_cast<std::size_t>(token.Ptr - base) <= MaxOffset && token.Length <= MaxLength;
+        }
+
+        [[nodiscard]] static constexpr PackedRouteToken Pack(const RouteToken& token, const char* base) noexcept
+        {
+            const bool isIndex = (token.Type == RouteTokenType::Index);
+            return PackedRouteToken{
+                .Offset        = static_cast<std::uint16_t>(token.Ptr - base),
+                .LengthAndType = static_cast<std::uint16_t>(token.Length | (isIndex ? IndexFlag : 0)),
+                .Value         = isIndex ? token.Index : 0
+            };
+        }
+
+        [[nodiscard]] constexpr RouteTokenType GetType() const noexcept
+        {
+            return (LengthAndType & IndexFlag) != 0 ? RouteTokenType::Index : RouteTokenType::Key;
+        }
+
+        [[nodiscard]] constexpr std::uint16_t GetLength() const noexcept
+        {
+            return static_cast<std::uint16_t>(LengthAndType & ~IndexFlag);
+        }
+
+        [[nodiscard]] constexpr RouteToken Unpack(const char* base) const noexcept
+        {
+            const bool isIndex = (GetType() == RouteTokenType::Index);
+            return RouteToken{
+                .Ptr    = base + Offset,
+                .Length = GetLength(),
+                .Type   = GetType(),
+                .Index  = isIndex ? Value : 0
+            };
+        }
+    };
+
+    static_assert(sizeof(PackedRouteToken) == 8, "PackedRouteToken expected to be 8 bytes.");
+
     template <std::size_t N>
     struct StringLiteral
     {
@@ -55,20 +163,12 @@ namespace charted
 
     namespace detail
     {
-        template <std::size_t MaxTokens>
-        struct ParsedStaticRoute
+        // Walks a route literal and emits its tokens. Returns false on malformed input.
+        template <StringLiteral Path, typename TEmit>
+        constexpr bool WalkStaticRoute(TEmit&& emit) noexcept
         {
-            std::array<RouteToken, MaxTokens> Tokens{};
-            std::size_t                       Count{ 0 };
-            bool                              Valid{ true };
-        };
-
-        template <StringLiteral Path, std::size_t MaxTokens>
-        consteval ParsedStaticRoute<MaxTokens> ParseStaticRoute() noexcept
-        {
-            ParsedStaticRoute<MaxTokens> parsed{};
-            constexpr std::size_t pathSize = Path.Size();
-            constexpr std::size_t length   = (pathSize > 0) ? (pathSize - 1) : 0;
+            constexpr std::size_t pathSize       = Path.Size();
+            constexpr std::size_t length         = (pathSize > 0) ? (pathSize - 1) : 0;
             constexpr std::size_t maxTokenLength = 65535;
 
             std::size_t cursor = 0;
@@ -78,8 +178,7 @@ namespace charted
                 {
                     if ((cursor + 1) < length && Path.Data[cursor + 1] == '.')
                     {
-                        parsed.Valid = false;
-                        return parsed;
+                        return false;
                     }
                     ++cursor;
                     continue;
@@ -93,25 +192,31 @@ namespace charted
 
                 if (keyStart < cursor)
                 {
-                    if (parsed.Count >= MaxTokens)
-                    {
-                        parsed.Valid = false;
-                        return parsed;
-                    }
                     if ((cursor - keyStart) > maxTokenLength)
                     {
-                        parsed.Valid = false;
-                        return parsed;
+                        return false;
                     }
-                    parsed.Tokens[parsed.Count++] = RouteToken{
+                    emit(RouteToken{
                         .Ptr    = Path.Data + keyStart,
                         .Length = static_cast<std::uint16_t>(cursor - keyStart),
                         .Type   = RouteTokenType::Key,
                         .Index  = 0
-                    };
+                    }, false);
                 }
 
-                if (cursor < length && Path.Data[cursor] == '[')
+                if (cursor < length && Path.Data[cursor] == '[' && (cursor + 2) < length &&
+                    Path.Data[cursor + 1] == '$' && Path.Data[cursor + 2] == ']')
+                {
+                    emit(RouteToken{
+                        .Ptr    = Path.Data + cursor + 1,
+                        .Length = 1,
+                        .Type   = RouteTokenType::Index,
+                        .Index  = 0
+                    }, true);
+
+                    cursor += 3;
+                }
+                else if (cursor < length && Path.Data[cursor] == '[')
                 {
                     ++cursor;
                     const std::size_t indexStart = cursor;
@@ -120,16 +225,18 @@ namespace charted
                         const char c = Path.Data[cursor];
                         if (c < '0' || c > '9')
                         {
-                            parsed.Valid = false;
-                            return parsed;
+                            return false;
                         }
                         ++cursor;
                     }
 
                     if (cursor >= length || indexStart == cursor)
                     {
-                        parsed.Valid = false;
-                        return parsed;
+                        return false;
+                    }
+                    if ((cursor - indexStart) > maxTokenLength)
+                    {
+                        return false;
                     }
 
                     std::uint32_t index = 0;
@@ -138,23 +245,12 @@ namespace charted
                         index = (index * 10u) + static_cast<std::uint32_t>(Path.Data[i] - '0');
                     }
 
-                    if (parsed.Count >= MaxTokens)
-                    {
-                        parsed.Valid = false;
-                        return parsed;
-                    }
-                    if ((cursor - indexStart) > maxTokenLength)
-                    {
-                        parsed.Valid = false;
-                        return parsed;
-                    }
-
-                    parsed.Tokens[parsed.Count++] = RouteToken{
+                    emit(RouteToken{
                         .Ptr    = Path.Data + indexStart,
                         .Length = static_cast<std::uint16_t>(cursor - indexStart),
                         .Type   = RouteTokenType::Index,
                         .Index  = index
-                    };
+                    }, false);
 
                     ++cursor;
                 }
@@ -163,130 +259,243 @@ namespace charted
                 {
                     if ((cursor + 1) < length && Path.Data[cursor + 1] == '.')
                     {
-                        parsed.Valid = false;
-                        return parsed;
+                        return false;
                     }
                     ++cursor;
                 }
             }
 
+            return true;
+        }
+
+        template <std::size_t Count>
+        struct ParsedStaticRoute
+        {
+            std::array<RouteToken, Count> Tokens{};
+            std::array<bool, Count>       Holes{};  // Index tokens written as [$], filled in at runtime.
+            std::size_t                   TokenCount{ 0 };
+            std::size_t                   HoleCount{ 0 };
+            bool                          Valid{ true };
+        };
+
+        // Parses into a MaxTokens-sized scratch array. TokenCount keeps counting past MaxTokens so the caller
+        // can report the overflow.
+        template <StringLiteral Path, std::size_t MaxTokens>
+        consteval ParsedStaticRoute<MaxTokens> ParseStaticRoute() noexcept
+        {
+            ParsedStaticRoute<MaxTokens> parsed{};
+            parsed.Valid = WalkStaticRoute<Path>([&](RouteToken token, bool hole)
+            {
+                if (parsed.TokenCount < MaxTokens)
+                {
+                    parsed.Holes[parsed.TokenCount] = hole;
+                    parsed.HoleCount += hole ? 1 : 0;
+                    parsed.Tokens[parsed.TokenCount] = token;
+                }
+                ++parsed.TokenCount;
+            });
             return parsed;
         }
 
-        inline std::size_t EstimateTokenCapacity(std::string_view path) noexcept
+        // The scratch parse only lives in constant evaluation; StaticRoute stores the exact-size copy.
+        template <StringLiteral Path, std::size_t MaxTokens>
+        inline constexpr auto StaticRouteScratch = ParseStaticRoute<Path, MaxTokens>();
+
+        template <std::size_t Count, std::size_t MaxTokens>
+        consteval ParsedStaticRoute<Count> ShrinkStaticRoute(const ParsedStaticRoute<MaxTokens>& parsed) noexcept
         {
-            if (path.empty())
+            ParsedStaticRoute<Count> exact{};
+            for (std::size_t i = 0; i < Count; ++i)
             {
-                return 0;
+                exact.Tokens[i] = parsed.Tokens[i];
+                exact.Holes[i]  = parsed.Holes[i];
             }
+            exact.TokenCount = Count;
+            exact.HoleCount  = parsed.HoleCount;
+            exact.Valid      = parsed.Valid;
+            return exact;
+        }
 
-            std::size_t capacity = 1;
-            for (const char c : path)
+        // Delimiter scanners turn one block of the path into a bitmask of '.', '[' and ']' positions.
+        // Position i of the block maps to bit (i << Shift).
+        struct SwarRouteScanner
+        {
+            static constexpr std::size_t Width = 8;
+            static constexpr unsigned    Shift = 3;
+
+            [[nodiscard]] static std::uint64_t Load(const char* block) noexcept
             {
-                if (c == '.' || c == '[')
+                constexpr std::uint64_t low  = 0x7F7F7F7F7F7F7F7Full;
+                const std::uint64_t word = LoadRouteWord<8>(block);
+
+                // Sets the high bit of every byte equal to c, without cross-byte carries.
+                const auto match = [&](char c) noexcept
                 {
-                    ++capacity;
-                }
+                    const std::uint64_t x = word ^ (0x0101010101010101ull * static_cast<unsigned char>(c));
+                    return ~(((x & low) + low) | x | low);
+                };
+                return match('.') | match('[') | match(']');
+            }
+        };
+
+#if CHARTED_HAS_SSE2
+        struct Sse2RouteScanner
+        {
+            static constexpr std::size_t Width = 16;
+            static constexpr unsigned    Shift = 0;
+
+            [[nodiscard]] static std::uint64_t Load(const char* block) noexcept
+            {
+                const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+                const __m128i hits  = _mm_or_si128(
+                    _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('.')), _mm_cmpeq_epi8(bytes, _mm_set1_epi8('['))),
+                    _mm_cmpeq_epi8(bytes, _mm_set1_epi8(']')));
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(hits));
+            }
+        };
+
+        using DefaultRouteScanner = Sse2RouteScanner;
+#else
+        using DefaultRouteScanner = SwarRouteScanner;
+#endif
+
+        // Returns the delimiter bitmask for the block at start. A short tail is copied into a zeroed block, so
+        // routes shorter than one block still take the vector path.
+        template <typename TScanner>
+        [[nodiscard]] std::uint64_t LoadRouteDelimiters(std::string_view path, std::size_t start) noexcept
+        {
+            if (start + TScanner::Width <= path.size())
+            {
+                return TScanner::Load(path.data() + start);
             }
-            return capacity;
+
+            char tail[TScanner::Width]{};
+            std::memcpy(tail, path.data() + start, path.size() - start);
+            return TScanner::Load(tail);
         }
 
-        inline bool ParseDynamicRoute(std::string_view path, std::pmr::vector<RouteToken>& outTokens) noexcept
+        // Single-pass tokenizer driven by delimiter positions found a block at a time. The tests check it
+        // against a byte-at-a-time reference parser. emit(const RouteToken&) returns false to abort.
+        template <typename TScanner = DefaultRouteScanner, typename TEmit>
+        [[nodiscard]] bool TokenizeRoute(std::string_view path, TEmit&& emit) noexcept
         {
-            outTokens.clear();
             constexpr std::size_t maxTokenLength = 65535;
-            std::size_t cursor = 0;
-            while (cursor < path.size())
+            const std::size_t     length         = path.size();
+
+            const auto emitKey = [&](std::size_t begin, std::size_t end) noexcept
             {
-                if (path[cursor] == '.')
+                if (begin == end)
                 {
-                    if ((cursor + 1) < path.size() && path[cursor + 1] == '.')
-                    {
-                        outTokens.clear();
-                        return false;
-                    }
-                    ++cursor;
-                    continue;
+                    return true;
                 }
-
-                const std::size_t keyStart = cursor;
-                while (cursor < path.size() && path[cursor] != '.' && path[cursor] != '[')
+                if ((end - begin) > maxTokenLength)
                 {
-                    ++cursor;
+                    return false;
                 }
+                const std::string_view key = path.substr(begin, end - begin);
+                return static_cast<bool>(emit(RouteToken{
+                    .Ptr    = key.data(),
+                    .Length = static_cast<std::uint16_t>(key.size()),
+                    .Type   = RouteTokenType::Key,
+                    .Index  = 0
+                }));
+            };
 
-                if (keyStart < cursor)
+            std::size_t segmentStart = 0;
+            std::size_t indexStart   = 0;
+            bool        inIndex      = false;
+            for (std::size_t blockStart = 0; blockStart < length; blockStart += TScanner::Width)
+            {
+                std::uint64_t bits = LoadRouteDelimiters<TScanner>(path, blockStart);
+                for (; bits != 0; bits &= bits - 1)
                 {
-                    if ((cursor - keyStart) > maxTokenLength)
-                    {
-                        outTokens.clear();
-                        return false;
-                    }
-                    outTokens.push_back(RouteToken{
-                        .Ptr    = path.data() + keyStart,
-                        .Length = static_cast<std::uint16_t>(cursor - keyStart),
-                        .Type   = RouteTokenType::Key,
-                        .Index  = 0
-                    });
-                }
+                    const std::size_t position =
+                        blockStart + (static_cast<std::size_t>(std::countr_zero(bits)) >> TScanner::Shift);
+                    const char delimiter = path[position];
 
-                if (cursor < path.size() && path[cursor] == '[')
-                {
-                    ++cursor;
-                    const std::size_t indexStart = cursor;
-                    while (cursor < path.size() && path[cursor] != ']')
+                    if (inIndex)
                     {
-                        const char c = path[cursor];
-                        if (c < '0' || c > '9')
+                        // Only digits may appear between '[' and ']'.
+                        if (delimiter != ']' || position == indexStart || (position - indexStart) > maxTokenLength)
                         {
-                            outTokens.clear();
                             return false;
                         }
-                        ++cursor;
-                    }
 
-                    if (cursor >= path.size() || indexStart == cursor)
-                    {
-                        outTokens.clear();
-                        return false;
+                        std::uint32_t index = 0;
+                        for (std::size_t i = indexStart; i < position; ++i)
+                        {
+                            const char c = path[i];
+                            if (c < '0' || c > '9')
+                            {
+                                return false;
+                            }
+                            index = (index * 10u) + static_cast<std::uint32_t>(c - '0');
+                        }
+
+                        if (!emit(RouteToken{
+                                .Ptr    = path.data() + indexStart,
+                                .Length = static_cast<std::uint16_t>(position - indexStart),
+                                .Type   = RouteTokenType::Index,
+                                .Index  = index
+                            }))
+                        {
+                            return false;
+                        }
+                        inIndex      = false;
+                        segmentStart = position + 1;
+                        continue;
                     }
 
-                    std::uint32_t index = 0;
-                    for (std::size_t i = indexStart; i < cursor; ++i)
+                    // ']' outside brackets is part of a key.
+                    if (delimiter == ']')
                     {
-                        index = (index * 10u) + static_cast<std::uint32_t>(path[i] - '0');
+                        continue;
                     }
-                    if ((cursor - indexStart) > maxTokenLength)
+                    if (!emitKey(segmentStart, position))
                     {
-                        outTokens.clear();
                         return false;
                     }
 
-                    outTokens.push_back(RouteToken{
-                        .Ptr    = path.data() + indexStart,
-                        .Length = static_cast<std::uint16_t>(cursor - indexStart),
-                        .Type   = RouteTokenType::Index,
-                        .Index  = index
-                    });
-
-                    ++cursor;
-                }
-
-                if (cursor < path.size() && path[cursor] == '.')
-                {
-                    if ((cursor + 1) < path.size() && path[cursor + 1] == '.')
+                    if (delimiter == '.')
                     {
-                        outTokens.clear();
-                        return false;
+                        if ((position + 1) < length && path[position + 1] == '.')
+                        {
+                            return false;
+                        }
+                        segmentStart = position + 1;
+                    }
+                    else
+                    {
+                        inIndex    = true;
+                        indexStart = position + 1;
                     }
-                    ++cursor;
                 }
             }
 
-            return true;
+            return !inIndex && emitKey(segmentStart, length);
+        }
+
+        template <typename TScanner = DefaultRouteScanner>
+        bool ParseDynamicRoute(std::string_view path, std::vector<RouteToken>& outTokens) noexcept
+        {
+            outTokens.clear();
+            const bool valid = TokenizeRoute<TScanner>(path, [&](const RouteToken& token)
+            {
+                outTokens.push_back(token);
+                return true;
+            });
+
+            if (!valid)
+            {
+                outTokens.clear();
+            }
+            return valid;
         }
     } // namespace detail
 
+    // Owning route. The path is a plain std::string, so an rvalue string is adopted and moves take over its
+    // buffer. Up to InlineTokenCapacity tokens are stored inline; longer routes keep their tokens in a vector
+    // that moves steal. Copies and moves rebase the tokens onto the new path instead of re-parsing.
     class DynamicRoute
     {
     public:
@@ -295,44 +504,50 @@ namespace charted
         {
         }
 
-        explicit DynamicRoute(
-            std::string_view path,
-            std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
-            : Resource(InlineBuffer.data(), InlineBuffer.size(), upstream)
-            , Path(path, &Resource)
-            , Tokens(&Resource)
+        explicit DynamicRoute(std::string_view path)
+            : Path(path)
         {
-            Tokens.reserve(detail::EstimateTokenCapacity(Path));
             Parse();
         }
 
-        explicit DynamicRoute(
-            std::string path,
-            std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
-            : Resource(InlineBuffer.data(), InlineBuffer.size(), upstream)
-            , Path(path, &Resource)
-            , Tokens(&Resource)
+        explicit DynamicRoute(const char* path)
+            : DynamicRoute(std::string_view(path))
+        {
+        }
+
+        // Takes over the path buffer; tokens point into the adopted string.
+        explicit DynamicRoute(std::string&& path)
+            : Path(std::move(path))
         {
-            Tokens.reserve(detail::EstimateTokenCapacity(Path));
             Parse();
         }
 
+        // Routes used to allocate from a caller-supplied memory resource. They now always use the global heap,
+        // and the resource is ignored.
+        [[deprecated("DynamicRoute no longer allocates from a memory resource; drop the upstream argument")]]
+        explicit DynamicRoute(std::string_view path, std::pmr::memory_resource* upstream)
+            : DynamicRoute(path)
+        {
+            (void)upstream;
+        }
+
+        [[deprecated("DynamicRoute no longer allocates from a memory resource; drop the upstream argument")]]
+        explicit DynamicRoute(std::string&& path, std::pmr::memory_resource* upstream)
+            : DynamicRoute(std::move(path))
+        {
+            (void)upstream;
+        }
+
         DynamicRoute(const DynamicRoute& other)
-            : Resource(InlineBuffer.data(), InlineBuffer.size(), other.Resource.upstream_resource())
-            , Path(other.Path, &Resource)
-            , Tokens(&Resource)
+            : Path(other.Path)
+            , Valid(other.Valid)
         {
-            Tokens.reserve(other.Tokens.size());
-            Parse();
+            AssignTokens(other.GetTokens(), other.Path.data());
         }
 
         DynamicRoute(DynamicRoute&& other) noexcept
-            : Resource(InlineBuffer.data(), InlineBuffer.size(), other.Resource.upstream_resource())
-            , Path(other.Path, &Resource)
-            , Tokens(&Resource)
+            : DynamicRoute(std::move(other), other.Path.data())
         {
-            Tokens.reserve(other.Tokens.size());
-            Parse();
         }
 
         DynamicRoute& operator=(const DynamicRoute& other)
@@ -342,10 +557,9 @@ namespace charted
                 return *this;
             }
 
-            Resource.release();
-            Path = other.Path;
-            Tokens.reserve(other.Tokens.size());
-            Parse();
+            Path  = other.Path;
+            Valid = other.Valid;
+            AssignTokens(other.GetTokens(), other.Path.data());
             return *this;
         }
 
@@ -356,41 +570,422 @@ namespace charted
                 return *this;
             }
 
-            Resource.release();
-            Path = other.Path;
-            Tokens.reserve(other.Tokens.size());
-            Parse();
+            const char* otherBase = other.Path.data();
+            Path         = std::move(other.Path);
+            SpillTokens  = std::move(other.SpillTokens);
+            InlineTokens = other.InlineTokens;
+            Count        = other.Count;
+            Valid        = other.Valid;
+            Rebase(otherBase);
+            other.Reset();
             return *this;
         }
 
+        [[nodiscard]] std::string_view GetPathString() const noexcept { return Path; }
+        [[nodiscard]] std::span<const RouteToken> GetTokens() const noexcept
+        {
+            return { SpillTokens.empty() ? InlineTokens.data() : SpillTokens.data(), Count };
+        }
+        [[nodiscard]] std::size_t GetTokenCount() const noexcept { return Count; }
+        [[nodiscard]] bool IsValid() const noexcept { return Valid; }
+
+        [[deprecated("DynamicRoute allocates through the global heap, not a memory resource")]]
+        [[nodiscard]] std::pmr::memory_resource* GetMemoryResource() const noexcept
+        {
+            return std::pmr::new_delete_resource();
+        }
+
+    private:
+        // otherBase is captured before other.Path is moved from, so token pointers can be rebased.
+        DynamicRoute(DynamicRoute&& other, const char* otherBase) noexcept
+            : Path(std::move(other.Path))
+            , SpillTokens(std::move(other.SpillTokens))
+            , InlineTokens(other.InlineTokens)
+            , Count(other.Count)
+            , Valid(other.Valid)
+        {
+            Rebase(otherBase);
+            other.Reset();
+        }
+
+        // Short routes tokenize straight into the inline slots. The first token past InlineTokenCapacity stops
+        // that pass, and ParseSpilled starts over with the spill path.
+        void Parse()
+        {
+            std::size_t count    = 0;
+            bool        overflow = false;
+            Valid = detail::TokenizeRoute(Path, [&](const RouteToken& token)
+            {
+                if (count == InlineTokenCapacity)
+                {
+                    overflow = true;
+                    return false;
+                }
+                InlineTokens[count++] = token;
+                return true;
+            });
+
+            if (overflow)
+            {
+                ParseSpilled();
+            }
+            else if (Valid)
+            {
+                Count = count;
+            }
+        }
+
+        // Tokens are staged on the stack and stored once, at their final size. A route with more tokens than
+        // the stage holds is tokenized again into exactly reserved storage, so the noexcept tokenizer never
+        // allocates.
+        void ParseSpilled()
+        {
+            constexpr std::size_t stagingCapacity = 32;
+
+            std::array<RouteToken, stagingCapacity> staged;
+            std::size_t                             count = 0;
+            Valid = detail::TokenizeRoute(Path, [&](const RouteToken& token)
+            {
+                if (count < stagingCapacity)
+                {
+                    staged[count] = token;
+                }
+                ++count;
+                return true;
+            });
+            if (!Valid)
+            {
+                return;
+            }
+
+            if (count <= stagingCapacity)
+            {
+                SpillTokens.assign(staged.begin(), staged.begin() + static_cast<std::ptrdiff_t>(count));
+            }
+            else
+            {
+                SpillTokens.reserve(count);
+                (void)detail::TokenizeRoute(Path, [&](const RouteToken& token)
+                {
+                    SpillTokens.push_back(token);
+                    return true;
+                });
+            }
+            Count = count;
+        }
+
+        // Copies tokens parsed against sourceBase and rebases them onto Path without re-parsing.
+        void AssignTokens(std::span<const RouteToken> tokens, const char* sourceBase)
+        {
+            if (tokens.size() > InlineTokenCapacity)
+            {
+                SpillTokens.assign(tokens.begin(), tokens.end());
+            }
+            else
+            {
+                SpillTokens.clear();
+                std::copy(tokens.begin(), tokens.end(), InlineTokens.begin());
+            }
+            Count = tokens.size();
+            Rebase(sourceBase);
+        }
+
+        void Rebase(const char* sourceBase) noexcept
+        {
+            RouteToken* tokens = SpillTokens.empty() ? InlineTokens.data() : SpillTokens.data();
+            for (RouteToken& token : std::span<RouteToken>(tokens, Count))
+            {
+                token.Ptr = Path.data() + (token.Ptr - sourceBase);
+            }
+        }
+
+        void Reset() noexcept
+        {
+            Path.clear();
+            SpillTokens.clear();
+            Count = 0;
+            Valid = true;
+        }
+
+        static constexpr std::size_t InlineTokenCapacity = 4;
+        std::string                                    Path;
+        std::vector<RouteToken>                        SpillTokens;
+        std::array<RouteToken, InlineTokenCapacity>    InlineTokens{};
+        std::size_t                                    Count{ 0 };
+        bool                                           Valid{ true };
+    };
+
+    // Non-owning route: tokenizes a path into caller-provided token storage without copying the
+    // path or allocating. Both the path text and the storage must outlive the view. A path with
+    // more tokens than the storage holds yields an invalid view.
+    class RouteView
+    {
+    public:
+        RouteView() = default;
+
+        RouteView(std::string_view path, std::span<RouteToken> storage) noexcept
+            : Path(path)
+        {
+            std::size_t count = 0;
+            Valid = detail::TokenizeRoute(Path, [&](const RouteToken& token)
+            {
+                if (count == storage.size())
+                {
+                    return false;
+                }
+                storage[count++] = token;
+                return true;
+            });
+            Tokens = Valid ? std::span<const RouteToken>(storage.data(), count) : std::span<const RouteToken>{};
+        }
+
         [[nodiscard]] std::string_view GetPathString() const noexcept { return Path; }
         [[nodiscard]] std::span<const RouteToken> GetTokens() const noexcept { return Tokens; }
         [[nodiscard]] std::size_t GetTokenCount() const noexcept { return Tokens.size(); }
         [[nodiscard]] bool IsValid() const noexcept { return Valid; }
-        [[nodiscard]] std::pmr::memory_resource* GetMemoryResource() const noexcept
+
+    private:
+        std::string_view            Path;
+        std::span<const RouteToken> Tokens;
+        bool                        Valid{ true };
+    };
+
+    // RouteView variant that keeps up to Capacity tokens inline, e.g. on the stack of a request handler.
+    // Tokens point into the path, not into the object, so copies stay valid.
+    template <std::size_t Capacity>
+    class InlineRouteView
+    {
+    public:
+        static_assert(Capacity > 0, "Capacity must be greater than 0.");
+
+        InlineRouteView() = default;
+
+        explicit InlineRouteView(std::string_view path) noexcept
+            : Path(path)
         {
-            return Resource.upstream_resource();
+            Valid = detail::TokenizeRoute(Path, [&](const RouteToken& token)
+            {
+                if (Count == Capacity)
+                {
+                    return false;
+                }
+                Tokens[Count++] = token;
+                return true;
+            });
+            if (!Valid)
+            {
+                Count = 0;
+            }
+        }
+
+        [[nodiscard]] std::string_view GetPathString() const noexcept { return Path; }
+        [[nodiscard]] std::span<const RouteToken> GetTokens() const noexcept
+        {
+            return std::span<const RouteToken>(Tokens.data(), Count);
         }
+        [[nodiscard]] std::size_t GetTokenCount() const noexcept { return Count; }
+        [[nodiscard]] bool IsValid() const noexcept { return Valid; }
 
     private:
-        void Parse() { Valid = detail::ParseDynamicRoute(Path, Tokens); }
-
-        static constexpr std::size_t InlineBufferSize = 4 * sizeof(RouteToken);
-        std::array<std::byte, InlineBufferSize> InlineBuffer{};
-        std::pmr::monotonic_buffer_resource     Resource;
-        std::pmr::string                        Path;
-        std::pmr::vector<RouteToken>            Tokens;
-        bool                                    Valid{ true };
+        std::string_view                 Path;
+        std::array<RouteToken, Capacity> Tokens{};
+        std::size_t                      Count{ 0 };
+        bool                             Valid{ true };
     };
 
+    namespace detail
+    {
+        // Tokenizes path into packed tokens and hands them to store(std::span<const PackedRouteToken>, bool valid).
+        // Tokens are staged on the stack; only unusually long routes spill before the caller's final allocation.
+        // An invalid route, including one that does not fit the packed encoding, yields no tokens.
+        template <typename TStore>
+        decltype(auto) PackRouteTokens(std::string_view path, TStore&& store)
+        {
+            constexpr std::size_t stagingCapacity = 32;
+
+            std::array<PackedRouteToken, stagingCapacity> staged;
+            std::vector<PackedRouteToken>                 spilled;
+            std::size_t                                   count = 0;
+
+            const char* base  = path.data();
+            const bool  valid = TokenizeRoute(path, [&](const RouteToken& token)
+            {
+                if (!PackedRouteToken::CanPack(token, base))
+                {
+                    return false;
+                }
+                const PackedRouteToken packed = PackedRouteToken::Pack(token, base);
+                if (count < stagingCapacity)
+                {
+                    staged[count] = packed;
+                }
+                else
+                {
+                    if (spilled.empty())
+                    {
+                        spilled.assign(staged.begin(), staged.end());
+                    }
+                    spilled.push_back(packed);
+                }
+                ++count;
+                return true;
+            });
+
+            const PackedRouteToken* tokens = spilled.empty() ? staged.data() : spilled.data();
+            return store(std::span<const PackedRouteToken>(tokens, valid ? count : 0), valid);
+        }
+    } // namespace detail
+
+    // Route backed by packed tokens. The token table and the path text share one heap block, and tokens
+    // address the text by offset, so the block is position independent: a copy is one allocation and one
+    // memcpy, a move steals the pointer, and nothing is re-parsed or rebased. Paths longer than
+    // PackedRouteToken::MaxOffset or keys longer than PackedRouteToken::MaxLength make the route invalid.
+    class PackedRoute
+    {
+    public:
+        PackedRoute() = default;
+
+        explicit PackedRoute(std::string_view path)
+        {
+            detail::PackRouteTokens(path, [&](std::span<const PackedRouteToken> tokens, bool valid)
+            {
+                Assign(path, tokens, valid);
+            });
+        }
+
+        // Adopts tokens already packed against path, such as another route's tokens, instead of re-parsing it.
+        PackedRoute(std::string_view path, std::span<const PackedRouteToken> tokens, bool valid)
+        {
+            Assign(path, tokens, valid);
+        }
+
+        PackedRoute(const PackedRoute& other)
+            : Block(Allocate(other.GetBlockSize()))
+            , PathLength(other.PathLength)
+            , TokenCount(other.TokenCount)
+            , Valid(other.Valid)
+        {
+            if (Block != nullptr)
+            {
+                std::memcpy(Block.get(), other.Block.get(), GetBlockSize());
+            }
+        }
+
+        PackedRoute(PackedRoute&& other) noexcept
+            : Block(std::move(other.Block))
+            , PathLength(std::exchange(other.PathLength, 0))
+            , TokenCount(std::exchange(other.TokenCount, 0))
+            , Valid(std::exchange(other.Valid, true))
+        {
+        }
+
+        PackedRoute& operator=(const PackedRoute& other)
+        {
+            if (this != &other)
+            {
+                *this = PackedRoute(other);
+            }
+            return *this;
+        }
+
+        PackedRoute& operator=(PackedRoute&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Block      = std::move(other.Block);
+                PathLength = std::exchange(other.PathLength, 0);
+                TokenCount = std::exchange(other.TokenCount, 0);
+                Valid      = std::exchange(other.Valid, true);
+            }
+            return *this;
+        }
+
+        [[nodiscard]] std::string_view GetPathString() const noexcept
+        {
+            return PathLength != 0 ? std::string_view(GetText(), PathLength) : std::string_view{};
+        }
+
+        [[nodiscard]] std::span<const PackedRouteToken> GetTokens() const noexcept
+        {
+            return TokenCount != 0 ? std::span<const PackedRouteToken>(GetPacked(), TokenCount)
+                                   : std::span<const PackedRouteToken>{};
+        }
+
+        [[nodiscard]] std::size_t GetTokenCount() const noexcept { return TokenCount; }
+        [[nodiscard]] bool IsValid() const noexcept { return Valid; }
+
+    private:
+        void Assign(std::string_view path, std::span<const PackedRouteToken> tokens, bool valid)
+        {
+            PathLength = static_cast<std::uint32_t>(path.size());
+            TokenCount = static_cast<std::uint32_t>(tokens.size());
+            Valid      = valid;
+            Block      = Allocate(GetBlockSize());
+            if (!tokens.empty())
+            {
+                std::memcpy(Block.get(), tokens.data(), tokens.size_bytes());
+            }
+            if (!path.empty())
+            {
+                std::memcpy(Block.get() + tokens.size_bytes(), path.data(), path.size());
+            }
+        }
+
+        // operator new[] aligns for any fundamental type, so the tokens at the front of the block are aligned.
+        [[nodiscard]] static std::unique_ptr<char[]> Allocate(std::size_t size)
+        {
+            return size != 0 ? std::unique_ptr<char[]>(new char[size]) : nullptr;
+        }
+
+        [[nodiscard]] std::size_t GetBlockSize() const noexcept
+        {
+            return TokenCount * sizeof(PackedRouteToken) + PathLength;
+        }
+
+        [[nodiscard]] const PackedRouteToken* GetPacked() const noexcept
+        {
+            return std::launder(reinterpret_cast<const PackedRouteToken*>(Block.get()));
+        }
+
+        [[nodiscard]] const char* GetText() const noexcept
+        {
+            return Block.get() + TokenCount * sizeof(PackedRouteToken);
+        }
+
+        std::unique_ptr<char[]> Block;
+        std::uint32_t           PathLength{ 0 };
+        std::uint32_t           TokenCount{ 0 };
+        bool                    Valid{ true };
+    };
+
+    namespace detail
+    {
+        // Runtime array indices: integers other than bool and the character types, so a value can be range
+        // checked against std::uint32_t instead of converting implicitly.
+        template <typename T>
+        concept RouteIndexValue =
+            std::integral<T> && !std::same_as<std::remove_cv_t<T>, bool> && !std::same_as<std::remove_cv_t<T>, char> &&
+            !std::same_as<std::remove_cv_t<T>, wchar_t> && !std::same_as<std::remove_cv_t<T>, char8_t> &&
+            !std::same_as<std::remove_cv_t<T>, char16_t> && !std::same_as<std::remove_cv_t<T>, char32_t>;
+    } // namespace detail
+
+    template <typename TStaticRoute>
+    class BoundStaticRoute;
+
     template <StringLiteral Path, std::size_t MaxTokens = (Path.Size() > 1 ? (Path.Size() - 1) : 1)>
     class StaticRoute
     {
     public:
         static_assert(MaxTokens > 0, "MaxTokens must be greater than 0.");
-        static constexpr auto Parsed = detail::ParseStaticRoute<Path, MaxTokens>();
-        static_assert(Parsed.Valid, "Invalid route literal.");
-        static constexpr std::size_t TokenCount = Parsed.Count;
+        static_assert(detail::StaticRouteScratch<Path, MaxTokens>.Valid, "Invalid route literal.");
+        static_assert(detail::StaticRouteScratch<Path, MaxTokens>.TokenCount <= MaxTokens,
+                      "Route literal has more tokens than MaxTokens.");
+        // Sized to the parsed token count rather than MaxTokens, which is only an upper bound.
+        static constexpr auto Parsed =
+            detail::ShrinkStaticRoute<std::min(detail::StaticRouteScratch<Path, MaxTokens>.TokenCount, MaxTokens)>(
+                detail::StaticRouteScratch<Path, MaxTokens>);
+        static constexpr std::size_t TokenCount = Parsed.TokenCount;
+        static constexpr std::size_t HoleCount  = Parsed.HoleCount;
         static constexpr bool        Valid      = Parsed.Valid;
 
         [[nodiscard]] static constexpr std::string_view GetPathString() noexcept
@@ -398,13 +993,100 @@ namespace charted
             return std::string_view(Path.Data, Path.Size() - 1);
         }
 
+        // Routes with [$] placeholders only become usable once bound through operator().
         [[nodiscard]] static constexpr std::span<const RouteToken> GetTokens() noexcept
+            requires (HoleCount == 0)
         {
-            return std::span<const RouteToken>(Parsed.Tokens.data(), Parsed.Count);
+            return std::span<const RouteToken>(Parsed.Tokens.data(), TokenCount);
         }
 
         [[nodiscard]] constexpr std::size_t GetTokenCount() const noexcept { return TokenCount; }
         [[nodiscard]] constexpr bool IsValid() const noexcept { return Valid; }
+
+        // Fills the [$] placeholders, in order, with runtime indices. A negative index or one that does not fit
+        // std::uint32_t yields an invalid bound route instead of wrapping.
+        template <detail::RouteIndexValue... TIndices>
+            requires (HoleCount > 0 && sizeof...(TIndices) == HoleCount)
+        [[nodiscard]] constexpr BoundStaticRoute<StaticRoute> operator()(TIndices... indices) const noexcept
+        {
+            const bool inRange = (std::in_range<std::uint32_t>(indices) && ...);
+            return BoundStaticRoute<StaticRoute>({ (inRange ? static_cast<std::uint32_t>(indices) : 0u)... }, inRange);
+        }
+    };
+
+    // A StaticRoute with its placeholders filled. The structure comes from the literal. Json walks the
+    // literal's tokens and reads only the stored hole indices; the token copy serves APIs that walk GetTokens().
+    template <typename TStaticRoute>
+    class BoundStaticRoute
+    {
+    public:
+        using StaticRouteType = TStaticRoute;
+
+        static constexpr std::size_t TokenCount = TStaticRoute::TokenCount;
+        static constexpr std::size_t HoleCount  = TStaticRoute::HoleCount;
+
+        constexpr BoundStaticRoute(const std::array<std::uint32_t, HoleCount>& indices, bool valid) noexcept
+            : Indices(indices)
+            , Valid(valid)
+        {
+            [&]<std::size_t... I>(std::index_sequence<I...>)
+            {
+                ((Tokens[I] = TStaticRoute::Parsed.Tokens[I]), ...);
+            }(std::make_index_sequence<TokenCount>{});
+            for (std::size_t hole = 0; hole < HoleCount; ++hole)
+            {
+                Tokens[HolePositions[hole]].Index = indices[hole];
+            }
+        }
+
+        [[nodiscard]] static constexpr std::string_view GetPathString() noexcept
+        {
+            return TStaticRoute::GetPathString();
+        }
+
+        [[nodiscard]] constexpr std::span<const RouteToken> GetTokens() const noexcept
+        {
+            return std::span<const RouteToken>(Tokens.data(), TokenCount);
+        }
+
+        [[nodiscard]] constexpr std::size_t GetTokenCount() const noexcept { return TokenCount; }
+        [[nodiscard]] constexpr bool IsValid() const noexcept { return TStaticRoute::Valid && Valid; }
+
+        // Index bound to the hole at token position Position.
+        template <std::size_t Position>
+            requires (Position < TokenCount && TStaticRoute::Parsed.Holes[Position])
+        [[nodiscard]] constexpr std::uint32_t GetBoundIndex() const noexcept
+        {
+            constexpr std::size_t hole = []
+            {
+                std::size_t count = 0;
+                for (std::size_t i = 0; i < Position; ++i)
+                {
+                    count += TStaticRoute::Parsed.Holes[i] ? 1 : 0;
+                }
+                return count;
+            }();
+            return Indices[hole];
+        }
+
+    private:
+        static constexpr std::array<std::size_t, HoleCount> HolePositions = []
+        {
+            std::array<std::size_t, HoleCount> positions{};
+            std::size_t hole = 0;
+            for (std::size_t i = 0; i < TokenCount; ++i)
+            {
+                if (TStaticRoute::Parsed.Holes[i])
+                {
+                    positions[hole++] = i;
+                }
+            }
+            return positions;
+        }();
+
+        std::array<std::uint32_t, HoleCount> Indices;
+        bool                                 Valid;
+        std::array<RouteToken, TokenCount>   Tokens;
     };
 
     namespace concepts
@@ -419,14 +1101,138 @@ namespace charted
         {
         };
 
+        // Types accepted as routes by Json. Route types outside this header specialize it next to their definition.
+        template <typename T>
+        struct IsRouteType : IsStaticRoute<T>
+        {
+        };
+
+        template <typename T>
+        struct IsBoundStaticRoute : std::false_type
+        {
+        };
+
+        template <typename TStaticRoute>
+        struct IsBoundStaticRoute<BoundStaticRoute<TStaticRoute>> : std::true_type
+        {
+        };
+
+        template <typename TStaticRoute>
+        struct IsRouteType<BoundStaticRoute<TStaticRoute>> : std::true_type
+        {
+        };
+
+        template <>
+        struct IsRouteType<DynamicRoute> : std::true_type
+        {
+        };
+
+        template <>
+        struct IsRouteType<RouteView> : std::true_type
+        {
+        };
+
+        template <std::size_t Capacity>
+        struct IsRouteType<InlineRouteView<Capacity>> : std::true_type
+        {
+        };
+
+        template <>
+        struct IsRouteType<PackedRoute> : std::true_type
+        {
+        };
+
         template <typename T>
         concept Route =
-            (std::same_as<std::remove_cvref_t<T>, DynamicRoute> ||
-             IsStaticRoute<std::remove_cvref_t<T>>::value) &&
+            IsRouteType<std::remove_cvref_t<T>>::value &&
             requires(const std::remove_cvref_t<T>& route)
             {
                 { route.GetPathString() } -> std::convertible_to<std::string_view>;
+            } &&
+            (requires(const std::remove_cvref_t<T>& route)
+            {
                 { route.GetTokens() } -> std::convertible_to<std::span<const RouteToken>>;
-            };
+            } ||
+            requires(const std::remove_cvref_t<T>& route)
+            {
+                { route.GetTokens() } -> std::convertible_to<std::span<const PackedRouteToken>>;
+            });
     } // namespace concepts
+
+    namespace detail
+    {
+        // Presents a packed token table as RouteTokens, unpacked on access against the path base.
+        class PackedRouteTokenRange
+        {
+        public:
+            class Iterator
+            {
+            public:
+                constexpr Iterator(const PackedRouteToken* token, const char* base) noexcept
+                    : Token(token)
+                    , Base(base)
+                {
+                }
+
+                [[nodiscard]] constexpr RouteToken operator*() const noexcept { return Token->Unpack(Base); }
+                constexpr Iterator& operator++() noexcept
+                {
+                    ++Token;
+                    return *this;
+                }
+                [[nodiscard]] constexpr bool operator==(const Iterator& other) const noexcept
+                {
+                    return Token == other.Token;
+                }
+
+            private:
+                const PackedRouteToken* Token;
+                const char*             Base;
+            };
+
+            constexpr PackedRouteTokenRange(std::span<const PackedRouteToken> tokens, const char* base) noexcept
+                : Tokens(tokens)
+                , Base(base)
+            {
+            }
+
+            [[nodiscard]] constexpr Iterator begin() const noexcept { return Iterator(Tokens.data(), Base); }
+            [[nodiscard]] constexpr Iterator end() const noexcept
+            {
+                return Iterator(Tokens.data() + Tokens.size(), Base);
+            }
+            [[nodiscard]] constexpr std::size_t size() const noexcept { return Tokens.size(); }
+            [[nodiscard]] constexpr bool empty() const noexcept { return Tokens.empty(); }
+            [[nodiscard]] constexpr RouteToken operator[](std::size_t i) const noexcept
+            {
+                return Tokens[i].Unpack(Base);
+            }
+            [[nodiscard]] constexpr RouteToken back() const noexcept { return Tokens.back().Unpack(Base); }
+
+        private:
+            std::span<const PackedRouteToken> Tokens;
+            const char*                       Base;
+        };
+
+        // Routes whose GetTokens() yields PackedRouteTokens addressed relative to GetPathString().
+        template <typename TRoute>
+        concept PackedTokenRoute = concepts::Route<TRoute> && requires(const std::remove_cvref_t<TRoute>& route)
+        {
+            { route.GetTokens() } -> std::convertible_to<std::span<const PackedRouteToken>>;
+        };
+
+        // Uniform token access for generic code: a span of RouteToken, or packed tokens unpacked on the fly.
+        template <concepts::Route TRoute>
+        [[nodiscard]] constexpr auto GetRouteTokens(const TRoute& routeValue) noexcept
+        {
+            if constexpr (PackedTokenRoute<TRoute>)
+            {
+                return PackedRouteTokenRange(routeValue.GetTokens(), routeValue.GetPathString().data());
+            }
+            else
+            {
+                return std::span<const RouteToken>(routeValue.GetTokens());
+            }
+        }
+    } // namespace detail
 }
\ No newline at end of file
@@ -0,0 +1,312 @@
+#pragma once
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "charted_route.hpp"
+
+namespace charted
+{
+    // Composes routes token by token. Keys and indices are appended to the token list directly and
+    // mirrored into the path text, so nothing is ever re-tokenized. Clear() and Truncate() keep the
+    // allocated storage, so a builder reused across loop iterations stops allocating.
+    class RouteBuilder
+    {
+    public:
+        RouteBuilder() = default;
+
+        template <concepts::Route TRoute>
+            requires (!std::same_as<std::remove_cvref_t<TRoute>, RouteBuilder>)
+        explicit RouteBuilder(const TRoute& base)
+        {
+            Append(base);
+        }
+
+        RouteBuilder(const RouteBuilder& other)
+            : Path(other.Path)
+            , Tokens(other.Tokens)
+            , TextOffsets(other.TextOffsets)
+            , InvalidFrom(other.InvalidFrom)
+        {
+            Rebase();
+        }
+
+        RouteBuilder(RouteBuilder&& other) noexcept
+            : Path(std::move(other.Path))
+            , Tokens(std::move(other.Tokens))
+            , TextOffsets(std::move(other.TextOffsets))
+            , InvalidFrom(std::exchange(other.InvalidFrom, NoInvalidToken))
+        {
+            Rebase();
+            other.Clear();
+        }
+
+        RouteBuilder& operator=(const RouteBuilder& other)
+        {
+            if (this != &other)
+            {
+                Path        = other.Path;
+                Tokens      = other.Tokens;
+                TextOffsets = other.TextOffsets;
+                InvalidFrom = other.InvalidFrom;
+                Rebase();
+            }
+            return *this;
+        }
+
+        RouteBuilder& operator=(RouteBuilder&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Path        = std::move(other.Path);
+                Tokens      = std::move(other.Tokens);
+                TextOffsets = std::move(other.TextOffsets);
+                InvalidFrom = std::exchange(other.InvalidFrom, NoInvalidToken);
+                Rebase();
+                other.Clear();
+            }
+            return *this;
+        }
+
+        // Keys must be non-empty and free of '.' and '[' so the path text parses back to the same tokens.
+        RouteBuilder& PushKey(std::string_view key)
+        {
+            const bool validKey = !key.empty() && key.size() <= std::numeric_limits<std::uint16_t>::max() &&
+                key.find_first_of(".[") == std::string_view::npos;
+
+            const char* base = Path.data();
+            if (!Path.empty())
+            {
+                Path += '.';
+            }
+            const std::size_t offset = Path.size();
+            Path.append(key);
+
+            PushToken(RouteToken{
+                .Length = static_cast<std::uint16_t>(key.size()),
+                .Type   = RouteTokenType::Key,
+                .Index  = 0
+            }, offset, base);
+
+            if (!validKey)
+            {
+                MarkLastInvalid();
+            }
+            return *this;
+        }
+
+        RouteBuilder& PushIndex(std::uint32_t index)
+        {
+            char digits[MaxIndexDigits];
+            const auto [end, error] = std::to_chars(digits, digits + sizeof(digits), index);
+            const std::size_t length = static_cast<std::size_t>(end - digits);
+
+            const char* base = Path.data();
+            Path += '[';
+            const std::size_t offset = Path.size();
+            Path.append(digits, length);
+            Path += ']';
+
+            PushToken(RouteToken{
+                .Length = static_cast<std::uint16_t>(length),
+                .Type   = RouteTokenType::Index,
+                .Index  = index
+            }, offset, base);
+            return *this;
+        }
+
+        // Appends every token of route; an invalid route marks the builder invalid.
+        template <concepts::Route TRoute>
+        RouteBuilder& Append(const TRoute& routeValue)
+        {
+            if constexpr (requires { { routeValue.IsValid() } -> std::convertible_to<bool>; })
+            {
+                if (!routeValue.IsValid() && InvalidFrom == NoInvalidToken)
+                {
+                    InvalidFrom = Tokens.size();
+                }
+            }
+
+            // Reserve first so the pushes below never reallocate: routeValue may be this builder, whose tokens
+            // and key text would otherwise move while they are being read.
+            std::size_t tokenCount = 0;
+            std::size_t textLength = 0;
+            for (const RouteToken& token : detail::GetRouteTokens(routeValue))
+            {
+                ++tokenCount;
+                textLength += (token.Type == RouteTokenType::Key) ? 1 + token.Length : 2 + MaxIndexDigits;
+            }
+            Reserve(tokenCount, textLength);
+
+            for (const RouteToken& token : detail::GetRouteTokens(routeValue))
+            {
+                if (token.Type == RouteTokenType::Key)
+                {
+                    PushKey(token.GetString());
+                }
+                else
+                {
+                    PushIndex(token.Index);
+                }
+            }
+            return *this;
+        }
+
+        void Pop() noexcept
+        {
+            if (!Tokens.empty())
+            {
+                Truncate(Tokens.size() - 1);
+            }
+        }
+
+        // Drops tokens past count, keeping capacity.
+        void Truncate(std::size_t count) noexcept
+        {
+            if (count >= Tokens.size())
+            {
+                return;
+            }
+
+            Path.resize(SegmentStart(count));
+            Tokens.resize(count);
+            TextOffsets.resize(count);
+            if (InvalidFrom != NoInvalidToken && count < InvalidFrom)
+            {
+                InvalidFrom = NoInvalidToken;
+            }
+        }
+
+        void Clear() noexcept
+        {
+            Path.clear();
+            Tokens.clear();
+            TextOffsets.clear();
+            InvalidFrom = NoInvalidToken;
+        }
+
+        RouteBuilder& operator/=(std::string_view key) { return PushKey(key); }
+
+        // An index outside std::uint32_t is recorded as [0] and invalidates the route, like a malformed key.
+        template <detail::RouteIndexValue TIndex>
+        RouteBuilder& operator/=(TIndex index)
+        {
+            const bool inRange = std::in_range<std::uint32_t>(index);
+            PushIndex(inRange ? static_cast<std::uint32_t>(index) : 0);
+            if (!inRange)
+            {
+                MarkLastInvalid();
+            }
+            return *this;
+        }
+
+        [[nodiscard]] std::string_view GetPathString() const noexcept { return Path; }
+        [[nodiscard]] std::span<const RouteToken> GetTokens() const noexcept { return Tokens; }
+        [[nodiscard]] std::size_t GetTokenCount() const noexcept { return Tokens.size(); }
+        [[nodiscard]] bool IsValid() const noexcept
+        {
+            return InvalidFrom == NoInvalidToken || Tokens.size() < InvalidFrom;
+        }
+
+    private:
+        static constexpr std::size_t NoInvalidToken = std::numeric_limits<std::size_t>::max();
+        static constexpr std::size_t MaxIndexDigits = std::numeric_limits<std::uint32_t>::digits10 + 1;
+
+        void MarkLastInvalid() noexcept
+        {
+            if (InvalidFrom == NoInvalidToken)
+            {
+                InvalidFrom = Tokens.size();
+            }
+        }
+
+        void Reserve(std::size_t tokenCount, std::size_t textLength)
+        {
+            const char* base = Path.data();
+            Path.reserve(Path.size() + textLength);
+            Tokens.reserve(Tokens.size() + tokenCount);
+            TextOffsets.reserve(TextOffsets.size() + tokenCount);
+            if (Path.data() != base)
+            {
+                Rebase();
+            }
+        }
+
+        void PushToken(RouteToken token, std::size_t offset, const char* previousBase)
+        {
+            token.Ptr = Path.data() + offset;
+            Tokens.push_back(token);
+            TextOffsets.push_back(static_cast<std::uint32_t>(offset));
+            if (Path.data() != previousBase)
+            {
+                Rebase();
+            }
+        }
+
+        // Re-points tokens at Path after its buffer moved.
+        void Rebase() noexcept
+        {
+            for (std::size_t i = 0; i < Tokens.size(); ++i)
+            {
+                Tokens[i].Ptr = Path.data() + TextOffsets[i];
+            }
+        }
+
+        // Offset of the delimiter that introduces token i ('.' or '['), or 0 for a leading key.
+        [[nodiscard]] std::size_t SegmentStart(std::size_t i) const noexcept
+        {
+            const bool hasDelimiter = (Tokens[i].Type == RouteTokenType::Index) || (TextOffsets[i] > 0);
+            return TextOffsets[i] - (hasDelimiter ? 1 : 0);
+        }
+
+        std::string                Path;
+        std::vector<RouteToken>    Tokens;
+        std::vector<std::uint32_t> TextOffsets;
+        std::size_t                InvalidFrom{ NoInvalidToken };
+    };
+
+    namespace concepts
+    {
+        template <>
+        struct IsRouteType<RouteBuilder> : std::true_type
+        {
+        };
+    } // namespace concepts
+
+    template <concepts::Route TRoute>
+    [[nodiscard]] RouteBuilder operator/(const TRoute& base, std::string_view key)
+    {
+        RouteBuilder builder(base);
+        builder /= key;
+        return builder;
+    }
+
+    template <concepts::Route TRoute, detail::RouteIndexValue TIndex>
+    [[nodiscard]] RouteBuilder operator/(const TRoute& base, TIndex index)
+    {
+        RouteBuilder builder(base);
+        builder /= index;
+        return builder;
+    }
+
+    [[nodiscard]] inline RouteBuilder operator/(RouteBuilder&& builder, std::string_view key)
+    {
+        builder /= key;
+        return std::move(builder);
+    }
+
+    template <detail::RouteIndexValue TIndex>
+    [[nodiscard]] RouteBuilder operator/(RouteBuilder&& builder, TIndex index)
+    {
+        builder /= index;
+        return std::move(builder);
+    }
+}
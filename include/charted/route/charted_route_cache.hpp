@@ -0,0 +1,322 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "charted_route.hpp"
+
+namespace charted
+{
+    // Interns compiled dynamic routes by path text so repeated expressions are parsed once.
+    // A path hashes to two candidate buckets of WayCount slots and is stored in the emptier one. The cache
+    // allocates twice as many slots as its capacity, so routes up to the capacity fit without conflict
+    // evictions. It never holds more than GetCapacity() routes: once full, an insert evicts with CLOCK
+    // (second chance) over all slots. Lookups never block; inserts take a writer mutex.
+    class RouteCache
+    {
+    public:
+        using Handle = std::shared_ptr<const DynamicRoute>;
+
+        static constexpr std::size_t WayCount = 4;
+
+        // Hit and miss counters are atomics shared by every thread, so they are kept only on request.
+        explicit RouteCache(std::size_t capacity = 4096, bool countStatistics = false)
+            : Capacity(std::max<std::size_t>(capacity, 1))
+            , BucketCount(std::bit_ceil(std::max<std::size_t>((2 * Capacity + WayCount - 1) / WayCount, 1)))
+            , Buckets(std::make_unique<Bucket[]>(BucketCount))
+            , CountStatistics(countStatistics)
+        {
+        }
+
+        RouteCache(const RouteCache&)            = delete;
+        RouteCache& operator=(const RouteCache&) = delete;
+
+        // Returns the compiled route for path, parsing and inserting it on a miss.
+        // The handle keeps the route alive after it is evicted.
+        [[nodiscard]] Handle Get(std::string_view path)
+        {
+            return Lookup(path, [](const Entry& entry) { return MakeHandle(entry); });
+        }
+
+        // Calls fn(const DynamicRoute&) with the compiled route for path, parsing and inserting it on a miss.
+        // No handle is made, so threads sharing a hot route do not contend on its reference count. The route
+        // may be evicted once fn returns and must not be kept.
+        template <typename TFn>
+        decltype(auto) Visit(std::string_view path, TFn&& fn)
+        {
+            return Lookup(path, [&](const Entry& entry) -> decltype(auto)
+            {
+                return std::invoke(std::forward<TFn>(fn), std::as_const(entry.Route));
+            });
+        }
+
+        // Returns the cached route for path, or nullptr without parsing or inserting.
+        [[nodiscard]] Handle Find(std::string_view path) const noexcept
+        {
+            const std::size_t hash = std::hash<std::string_view>{}(path);
+            for (Bucket* bucket : { &GetBucket(hash), &GetAlternateBucket(hash) })
+            {
+                const ReaderGuard guard(*bucket);
+                if (const Entry* entry = FindEntry(*bucket, hash, path))
+                {
+                    return MakeHandle(*entry);
+                }
+            }
+            return nullptr;
+        }
+
+        void Clear()
+        {
+            const std::lock_guard lock(WriteMutex);
+            for (std::size_t i = 0; i < BucketCount; ++i)
+            {
+                Bucket& bucket = Buckets[i];
+                for (std::size_t way = 0; way < WayCount; ++way)
+                {
+                    if (bucket.Owners[way])
+                    {
+                        Retire(bucket, way);
+                    }
+                }
+                bucket.Hand = 0;
+                Reclaim(bucket);
+            }
+            Size.store(0, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] std::size_t GetCapacity() const noexcept { return Capacity; }
+        [[nodiscard]] std::size_t GetSize() const noexcept { return Size.load(std::memory_order_relaxed); }
+        [[nodiscard]] std::uint64_t GetHitCount() const noexcept { return Hits.load(std::memory_order_relaxed); }
+        [[nodiscard]] std::uint64_t GetMissCount() const noexcept { return Misses.load(std::memory_order_relaxed); }
+
+    private:
+        struct Entry : std::enable_shared_from_this<Entry>
+        {
+            Entry(std::size_t hash, std::string_view path)
+                : Hash(hash)
+                , Route(path)
+            {
+            }
+
+            std::size_t               Hash;
+            DynamicRoute              Route;
+            mutable std::atomic<bool> Referenced{ true };
+        };
+
+        // Readers publish themselves in Readers; evicted entries stay in Retired until a writer
+        // observes the bucket with no readers, so a slot pointer is never freed under a lookup.
+        struct alignas(64) Bucket
+        {
+            std::array<std::atomic<const Entry*>, WayCount> Slots{};
+            std::atomic<std::uint32_t>                      Readers{ 0 };
+            std::array<std::shared_ptr<Entry>, WayCount>    Owners{};
+            std::vector<std::shared_ptr<Entry>>             Retired;
+            std::size_t                                     Hand{ 0 };
+        };
+
+        class ReaderGuard
+        {
+        public:
+            explicit ReaderGuard(Bucket& bucket) noexcept
+                : Guarded(bucket)
+            {
+                Guarded.Readers.fetch_add(1, std::memory_order_seq_cst);
+            }
+
+            ReaderGuard(const ReaderGuard&)            = delete;
+            ReaderGuard& operator=(const ReaderGuard&) = delete;
+
+            ~ReaderGuard() { Guarded.Readers.fetch_sub(1, std::memory_order_release); }
+
+        private:
+            Bucket& Guarded;
+        };
+
+        [[nodiscard]] Bucket& GetBucket(std::size_t hash) const noexcept
+        {
+            return Buckets[hash & (BucketCount - 1)];
+        }
+
+        // The second candidate comes from the high bits, mixed so that it does not follow the first.
+        [[nodiscard]] Bucket& GetAlternateBucket(std::size_t hash) const noexcept
+        {
+            const std::uint64_t mixed = static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+            return Buckets[static_cast<std::size_t>(mixed >> 32) & (BucketCount - 1)];
+        }
+
+        [[nodiscard]] static Handle MakeHandle(const Entry& entry) noexcept
+        {
+            return Handle(entry.weak_from_this().lock(), std::addressof(entry.Route));
+        }
+
+        // Runs fn(const Entry&) on the entry for path, inserting it on a miss. A found entry is used while its
+        // bucket is still guarded, so it cannot be reclaimed under fn.
+        template <typename TFn>
+        std::invoke_result_t<TFn&, const Entry&> Lookup(std::string_view path, TFn&& fn)
+        {
+            const std::size_t hash = std::hash<std::string_view>{}(path);
+            for (Bucket* bucket : { &GetBucket(hash), &GetAlternateBucket(hash) })
+            {
+                const ReaderGuard guard(*bucket);
+                if (const Entry* entry = FindEntry(*bucket, hash, path))
+                {
+                    if (CountStatistics)
+                    {
+                        Hits.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    return fn(*entry);
+                }
+            }
+
+            if (CountStatistics)
+            {
+                Misses.fetch_add(1, std::memory_order_relaxed);
+            }
+            const std::shared_ptr<const Entry> entry = Insert(hash, path);
+            return fn(*entry);
+        }
+
+        // The caller holds a ReaderGuard on bucket.
+        [[nodiscard]] static const Entry* FindEntry(const Bucket& bucket, std::size_t hash, std::string_view path) noexcept
+        {
+            for (const auto& slot : bucket.Slots)
+            {
+                const Entry* entry = slot.load(std::memory_order_seq_cst);
+                if (entry != nullptr && entry->Hash == hash && entry->Route.GetPathString() == path)
+                {
+                    // Only write the flag when it is clear, so hits on a hot entry do not bounce its cache line.
+                    if (!entry->Referenced.load(std::memory_order_relaxed))
+                    {
+                        entry->Referenced.store(true, std::memory_order_relaxed);
+                    }
+                    return entry;
+                }
+            }
+            return nullptr;
+        }
+
+        [[nodiscard]] std::shared_ptr<const Entry> Insert(std::size_t hash, std::string_view path)
+        {
+            const std::lock_guard lock(WriteMutex);
+            Bucket& first  = GetBucket(hash);
+            Bucket& second = GetAlternateBucket(hash);
+            for (Bucket* bucket : { &first, &second })
+            {
+                for (const std::shared_ptr<Entry>& owner : bucket->Owners)
+                {
+                    if (owner && owner->Hash == hash && owner->Route.GetPathString() == path)
+                    {
+                        return owner;
+                    }
+                }
+            }
+
+            auto entry = std::make_shared<Entry>(hash, path);
+            if (Size.load(std::memory_order_relaxed) >= Capacity)
+            {
+                EvictAny();
+            }
+
+            Bucket& target = (CountOwners(second) < CountOwners(first)) ? second : first;
+            const std::size_t way = SelectVictim(target);
+            if (target.Owners[way])
+            {
+                Retire(target, way);
+            }
+            else
+            {
+                Size.fetch_add(1, std::memory_order_relaxed);
+            }
+            target.Owners[way] = entry;
+            target.Slots[way].store(entry.get(), std::memory_order_seq_cst);
+            Reclaim(target);
+            return entry;
+        }
+
+        [[nodiscard]] static std::size_t CountOwners(const Bucket& bucket) noexcept
+        {
+            return static_cast<std::size_t>(std::count_if(bucket.Owners.begin(), bucket.Owners.end(),
+                [](const std::shared_ptr<Entry>& owner) { return owner != nullptr; }));
+        }
+
+        // Picks a free way, or the CLOCK victim of a full bucket.
+        [[nodiscard]] static std::size_t SelectVictim(Bucket& bucket) noexcept
+        {
+            for (std::size_t way = 0; way < WayCount; ++way)
+            {
+                if (!bucket.Owners[way])
+                {
+                    return way;
+                }
+            }
+
+            // CLOCK: clear reference bits until an entry that was not touched since the last sweep is found.
+            while (true)
+            {
+                const std::size_t way = bucket.Hand;
+                bucket.Hand = (bucket.Hand + 1) % WayCount;
+                if (!bucket.Owners[way]->Referenced.exchange(false, std::memory_order_relaxed))
+                {
+                    return way;
+                }
+            }
+        }
+
+        // Keeps the cache at Capacity: a CLOCK hand over every slot evicts the first entry not touched since
+        // it last passed. Half the slots are empty on average, so a sweep step is cheap.
+        void EvictAny()
+        {
+            const std::size_t slotCount = BucketCount * WayCount;
+            while (true)
+            {
+                const std::size_t slot = GlobalHand;
+                GlobalHand = (GlobalHand + 1) % slotCount;
+
+                Bucket&           bucket = Buckets[slot / WayCount];
+                const std::size_t way    = slot % WayCount;
+                if (bucket.Owners[way] && !bucket.Owners[way]->Referenced.exchange(false, std::memory_order_relaxed))
+                {
+                    Retire(bucket, way);
+                    Reclaim(bucket);
+                    Size.fetch_sub(1, std::memory_order_relaxed);
+                    return;
+                }
+            }
+        }
+
+        static void Retire(Bucket& bucket, std::size_t way)
+        {
+            bucket.Slots[way].store(nullptr, std::memory_order_seq_cst);
+            bucket.Retired.push_back(std::move(bucket.Owners[way]));
+        }
+
+        static void Reclaim(Bucket& bucket) noexcept
+        {
+            if (!bucket.Retired.empty() && bucket.Readers.load(std::memory_order_seq_cst) == 0)
+            {
+                bucket.Retired.clear();
+            }
+        }
+
+        std::size_t                Capacity;
+        std::size_t                BucketCount;
+        std::unique_ptr<Bucket[]>  Buckets;
+        bool                       CountStatistics;
+        std::size_t                GlobalHand{ 0 };
+        std::atomic<std::size_t>   Size{ 0 };
+        std::mutex                 WriteMutex;
+        // Kept apart from the fields every lookup reads, so counting does not slow down lookups on other cores.
+        alignas(64) std::atomic<std::uint64_t> Hits{ 0 };
+        std::atomic<std::uint64_t>             Misses{ 0 };
+    };
+}
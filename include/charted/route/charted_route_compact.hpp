@@ -0,0 +1,148 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "charted_route.hpp"
+
+namespace charted
+{
+    // Immutable route for large route tables. The handle is a single pointer to one reference-counted
+    // block holding a small header, the packed tokens and the path text, so a table entry costs 8 bytes
+    // plus one allocation. Copies share the block; nothing is ever re-tokenized or rebased.
+    class CompactRoute
+    {
+    public:
+        CompactRoute() noexcept = default;
+
+        explicit CompactRoute(std::string_view path)
+            : Block(Build(path))
+        {
+        }
+
+        CompactRoute(const CompactRoute& other) noexcept
+            : Block(other.Block)
+        {
+            Retain();
+        }
+
+        CompactRoute(CompactRoute&& other) noexcept
+            : Block(std::exchange(other.Block, nullptr))
+        {
+        }
+
+        CompactRoute& operator=(const CompactRoute& other) noexcept
+        {
+            CompactRoute(other).Swap(*this);
+            return *this;
+        }
+
+        CompactRoute& operator=(CompactRoute&& other) noexcept
+        {
+            CompactRoute(std::move(other)).Swap(*this);
+            return *this;
+        }
+
+        ~CompactRoute() { Release(); }
+
+        void Swap(CompactRoute& other) noexcept { std::swap(Block, other.Block); }
+
+        [[nodiscard]] std::string_view GetPathString() const noexcept
+        {
+            return Block != nullptr ? std::string_view(GetText(), Block->PathLength) : std::string_view{};
+        }
+
+        [[nodiscard]] std::span<const PackedRouteToken> GetTokens() const noexcept
+        {
+            return Block != nullptr ? std::span<const PackedRouteToken>(GetPacked(), Block->TokenCount)
+                                    : std::span<const PackedRouteToken>{};
+        }
+
+        [[nodiscard]] std::size_t GetTokenCount() const noexcept { return Block != nullptr ? Block->TokenCount : 0; }
+        [[nodiscard]] bool IsValid() const noexcept { return Block == nullptr || Block->Valid; }
+
+    private:
+        struct Header
+        {
+            std::atomic<std::uint32_t> RefCount{ 1 };
+            std::uint32_t              PathLength{ 0 };
+            std::uint32_t              TokenCount{ 0 };
+            bool                       Valid{ true };
+        };
+
+        static_assert(sizeof(Header) % alignof(PackedRouteToken) == 0, "Tokens must follow the header aligned.");
+
+        [[nodiscard]] static Header* Build(std::string_view path)
+        {
+            if (path.empty())
+            {
+                return nullptr;
+            }
+
+            return detail::PackRouteTokens(path, [&](std::span<const PackedRouteToken> tokens, bool valid)
+            {
+                void*   memory = ::operator new(sizeof(Header) + tokens.size_bytes() + path.size() + 1);
+                Header* header = ::new (memory) Header{};
+                header->PathLength = static_cast<std::uint32_t>(path.size());
+                header->TokenCount = static_cast<std::uint32_t>(tokens.size());
+                header->Valid      = valid;
+
+                auto* bytes = static_cast<char*>(memory) + sizeof(Header);
+                if (!tokens.empty())
+                {
+                    std::memcpy(bytes, tokens.data(), tokens.size_bytes());
+                }
+                std::memcpy(bytes + tokens.size_bytes(), path.data(), path.size());
+                bytes[tokens.size_bytes() + path.size()] = '\0';
+                return header;
+            });
+        }
+
+        [[nodiscard]] const PackedRouteToken* GetPacked() const noexcept
+        {
+            return std::launder(reinterpret_cast<const PackedRouteToken*>(
+                reinterpret_cast<const char*>(Block) + sizeof(Header)));
+        }
+
+        [[nodiscard]] const char* GetText() const noexcept
+        {
+            return reinterpret_cast<const char*>(Block) + sizeof(Header) + Block->TokenCount * sizeof(PackedRouteToken);
+        }
+
+        void Retain() const noexcept
+        {
+            if (Block != nullptr)
+            {
+                Block->RefCount.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        void Release() noexcept
+        {
+            if (Block != nullptr && Block->RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                Block->~Header();
+                ::operator delete(Block);
+            }
+            Block = nullptr;
+        }
+
+        Header* Block{ nullptr };
+    };
+
+    static_assert(sizeof(CompactRoute) == sizeof(void*), "CompactRoute expected to be a single pointer.");
+
+    namespace concepts
+    {
+        template <>
+        struct IsRouteType<CompactRoute> : std::true_type
+        {
+        };
+    } // namespace concepts
+}
@@ -1,19 +1,227 @@
 #pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
 #include <optional>
+#include <ranges>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "../charted/charted.hpp"
 #include "nlohmann/json.hpp"
 
+// Follows the compiler: 0 under -fno-exceptions (or /EHs-c- with _HAS_EXCEPTIONS=0). Every Json API then reports
+// failure through its return value, and the library contains no try/catch.
+#ifndef CHARTED_HAS_EXCEPTIONS
+    #if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || (defined(_CPPUNWIND) && (!defined(_HAS_EXCEPTIONS) || _HAS_EXCEPTIONS))
+        #define CHARTED_HAS_EXCEPTIONS 1
+    #else
+        #define CHARTED_HAS_EXCEPTIONS 0
+    #endif
+#endif
+
 namespace charted
 {
+    template <concepts::Route TRoute>
+    class BoundRoute;
+
+    class JsonConstRef;
+    class JsonRef;
+    struct JsonParseResult;
+
+    // What Take leaves behind at the route it moved a value out of.
+    enum class TakeMode : std::uint8_t
+    {
+        LeaveNull, // The node stays in place as null; sibling array indices are unchanged.
+        Erase      // The member or element is removed; later array elements shift down.
+    };
+
+    namespace detail
+    {
+        template <typename T>
+        struct IsOptional : std::false_type
+        {
+        };
+
+        template <typename T>
+        struct IsOptional<std::optional<T>> : std::true_type
+        {
+        };
+
+        // Results that point into the document instead of owning a copy; valid until the next mutation.
+        template <typename T>
+        concept BorrowedValue = std::same_as<T, std::string_view> || std::same_as<T, const std::string*>;
+
+        template <typename T>
+        struct IsStdArray : std::false_type
+        {
+        };
+
+        template <typename T, std::size_t N>
+        struct IsStdArray<std::array<T, N>> : std::true_type
+        {
+        };
+
+        template <typename T>
+        inline constexpr bool DependentFalse = false;
+
+        // Starting generation for a new document. Each call moves 2^32 generations past the previous one, so a
+        // document never matches a generation a handle cached from another document, even one that lived at the
+        // same address.
+        [[nodiscard]] inline std::uint64_t NextGenerationSeed() noexcept
+        {
+            static std::atomic<std::uint64_t> seed{ 0 };
+            return seed.fetch_add(std::uint64_t{ 1 } << 32, std::memory_order_relaxed) + (std::uint64_t{ 1 } << 32);
+        }
+    } // namespace detail
+
+    enum class JsonParseErrorKind : std::uint8_t
+    {
+        None,
+        UnexpectedEnd,   // Input ended inside a value.
+        UnexpectedToken, // A well-formed token appeared where the grammar does not allow it.
+        InvalidToken,    // Malformed literal, number or string.
+        Other
+    };
+
+    struct JsonParseError
+    {
+        JsonParseErrorKind Kind  { JsonParseErrorKind::None };
+        std::size_t        Offset{ 0 }; // Byte offset in the input where the error was detected.
+    };
+
+    namespace detail
+    {
+        // SAX handler for TryParse: builds the document and records the first parse error in the same pass, so
+        // rejected input is never parsed twice.
+        class JsonParseErrorCapture final : public nlohmann::json_sax<nlohmann::json>
+        {
+        public:
+            explicit JsonParseErrorCapture(std::string_view input) noexcept
+                : Input(input)
+            {
+            }
+
+            bool null() override { return Store(nullptr); }
+            bool boolean(bool value) override { return Store(value); }
+            bool number_integer(number_integer_t value) override { return Store(value); }
+            bool number_unsigned(number_unsigned_t value) override { return Store(value); }
+            bool number_float(number_float_t value, const string_t&) override { return Store(value); }
+            bool string(string_t& value) override { return Store(std::move(value)); }
+            bool binary(binary_t& value) override { return Store(std::move(value)); }
+
+            bool start_object(std::size_t) override
+            {
+                Stack.push_back(Emplace(nlohmann::json::value_t::object));
+                return true;
+            }
+
+            bool key(string_t& value) override
+            {
+                Member = std::addressof((*Stack.back())[std::move(value)]);
+                return true;
+            }
+
+            bool end_object() override
+            {
+                Stack.pop_back();
+                return true;
+            }
+
+            bool start_array(std::size_t) override
+            {
+                Stack.push_back(Emplace(nlohmann::json::value_t::array));
+                return true;
+            }
+
+            bool end_array() override
+            {
+                Stack.pop_back();
+                return true;
+            }
+
+            bool parse_error(std::size_t position, const std::string&, const nlohmann::detail::exception& ex) override
+            {
+                // nlohmann reports the count of bytes read, i.e. one past the byte that failed.
+                Error.Offset = std::min(position > 0 ? position - 1 : 0, Input.size());
+                Error.Kind   = Classify(ex, position);
+                return false;
+            }
+
+            nlohmann::json Root;
+            JsonParseError Error;
+
+        private:
+            template <typename T>
+            bool Store(T&& value)
+            {
+                (void)Emplace(std::forward<T>(value));
+                return true;
+            }
+
+            // Places a value at the document root, at the end of the open array, or at the pending object member.
+            template <typename T>
+            nlohmann::json* Emplace(T&& value)
+            {
+                if (Stack.empty())
+                {
+                    Root = nlohmann::json(std::forward<T>(value));
+                    return std::addressof(Root);
+                }
+                if (Stack.back()->is_array())
+                {
+                    Stack.back()->emplace_back(std::forward<T>(value));
+                    return std::addressof(Stack.back()->back());
+                }
+                *Member = nlohmann::json(std::forward<T>(value));
+                return Member;
+            }
+
+            // Uses only what the parse_error callback receives. 406 is a number too large for any number type and
+            // 101 a JSON syntax error. nlohmann words a 101 raised by the lexer as "<problem>; last read: '<text>'",
+            // so that suffix marks a malformed token. Any other 101 is a complete token in the wrong place, or the
+            // end of input when the failing byte lies past the input.
+            [[nodiscard]] JsonParseErrorKind Classify(const nlohmann::detail::exception& ex, std::size_t position) const noexcept
+            {
+                if (ex.id == 406)
+                {
+                    return JsonParseErrorKind::InvalidToken;
+                }
+                if (ex.id != 101)
+                {
+                    return JsonParseErrorKind::Other;
+                }
+                if (std::string_view(ex.what()).find("; last read: ") != std::string_view::npos)
+                {
+                    return JsonParseErrorKind::InvalidToken;
+                }
+                return (position > Input.size()) ? JsonParseErrorKind::UnexpectedEnd : JsonParseErrorKind::UnexpectedToken;
+            }
+
+            std::string_view             Input;
+            std::vector<nlohmann::json*> Stack;
+            nlohmann::json*              Member{ nullptr };
+        };
+    } // namespace detail
+
     class Json
     {
         using NativeJson = nlohmann::json;
 
+        template <concepts::Route TRoute>
+        friend class BoundRoute;
+        friend class JsonConstRef;
+        friend class JsonRef;
+
     public:
         Json() = default;
 
@@ -22,33 +230,71 @@ namespace charted
         {
         }
 
+        // Every constructor starts from a fresh generation rather than the source's, so a handle that cached
+        // another document's generation never mistakes this document for one it already resolved against.
+        Json(const Json& other)
+            : Root(other.Root)
+        {
+        }
+
+        Json(Json&& other) noexcept
+            : Root(std::move(other.Root))
+        {
+            ++other.Generation;
+        }
+
+        // Assignment replaces the whole document, so handles bound to this Json must re-resolve.
+        Json& operator=(const Json& other)
+        {
+            Root = other.Root;
+            ++Generation;
+            return *this;
+        }
+
+        Json& operator=(Json&& other) noexcept
+        {
+            Root = std::move(other.Root);
+            ++Generation;
+            ++other.Generation;
+            return *this;
+        }
+
+        // Never throws: malformed input is rejected by nlohmann's non-throwing parse mode.
         [[nodiscard]] static std::optional<Json> Parse(std::string_view jsonText) noexcept
         {
-            try
-            {
-                return Json(NativeJson::parse(jsonText));
-            }
-            catch (...)
+            NativeJson value = NativeJson::parse(jsonText, nullptr, false);
+            if (value.is_discarded())
             {
                 return std::nullopt;
             }
+            return Json(std::move(value));
         }
 
+        // Like Parse, but reports where and why malformed input was rejected. Valid input is parsed once;
+        // only rejected input pays for a second pass that locates the error.
+        [[nodiscard]] static JsonParseResult TryParse(std::string_view jsonText) noexcept;
+
         [[nodiscard]] bool IsNull() const noexcept { return Root.is_null(); }
         [[nodiscard]] bool IsDiscarded() const noexcept { return Root.is_discarded(); }
         [[nodiscard]] bool Contains(std::string_view key) const noexcept { return Root.contains(key); }
 
-        void Clear() noexcept { Root = NativeJson{}; }
+        void Clear() noexcept
+        {
+            Root = NativeJson{};
+            ++Generation;
+        }
 
+        // Invalid UTF-8 in strings is written as U+FFFD instead of throwing (or aborting without exceptions).
         [[nodiscard]] std::string Dump(bool pretty = true) const
         {
-            return pretty ? Root.dump(4) : Root.dump();
+            return DumpNative(Root, pretty);
         }
 
         template <typename T>
         Json& Set(std::string_view key, T&& value)
         {
-            Root[std::string(key)] = ToNative(std::forward<T>(value));
+            SetAt(Root, key, ToNative(std::forward<T>(value)));
+            ++Generation;
             return *this;
         }
 
@@ -59,25 +305,100 @@ namespace charted
             {
                 return *this;
             }
-            return SetPathValue(routeValue, ToNative(std::forward<T>(value)));
+            if (SetAt(Root, routeValue, ToNative(std::forward<T>(value))))
+            {
+                ++Generation;
+            }
+            return *this;
         }
 
-        template <typename T>
-        [[nodiscard]] std::optional<T> TryGet(std::string_view key) const noexcept
+        // Writes values[i] at routes[i] in order, so later writes win as with repeated Set calls. A route reuses
+        // the containers built for the prefix it shares with the previous route only, so pass routes sorted (or
+        // at least grouped by prefix); an unsorted batch degrades to one walk from the root per route. Only the
+        // first 32 levels are shared. Pass values as an rvalue container to move the elements in; views
+        // and spans are always copied from.
+        template <std::ranges::random_access_range TRoutes, std::ranges::random_access_range TValues>
+            requires concepts::Route<std::ranges::range_value_t<TRoutes>>
+        Json& SetMany(const TRoutes& routes, TValues&& values)
         {
-            try
+            SlotWalker        walker(Root);
+            const std::size_t count = std::min<std::size_t>(std::ranges::size(routes), std::ranges::size(values));
+            for (std::size_t i = 0; i < count; ++i)
             {
-                const auto it = Root.find(key);
-                if (it == Root.end())
+                auto&& element = std::ranges::begin(values)[i];
+                NativeJson value = MovesElements<TValues> ? ToNative(std::move(element)) : ToNative(element);
+                if (NativeJson* slot = walker.Slot(std::ranges::begin(routes)[i]))
                 {
-                    return std::nullopt;
+                    *slot = std::move(value);
                 }
-                return FromNative<T>(*it);
             }
-            catch (...)
+            ++Generation;
+            return *this;
+        }
+
+        // Heterogeneous form, e.g. SetMany(std::forward_as_tuple(nameRoute, portRoute), std::forward_as_tuple(name, 8080)).
+        template <typename... TRoutes, typename... TValues>
+            requires (sizeof...(TRoutes) == sizeof...(TValues) && (concepts::Route<std::remove_cvref_t<TRoutes>> && ...))
+        Json& SetMany(const std::tuple<TRoutes...>& routes, std::tuple<TValues...>&& values)
+        {
+            SlotWalker walker(Root);
+            [&]<std::size_t... I>(std::index_sequence<I...>)
             {
-                return std::nullopt;
+                (walker.Assign(std::get<I>(routes), ToNative(std::forward<TValues>(std::get<I>(values)))), ...);
+            }(std::index_sequence_for<TRoutes...>{});
+            ++Generation;
+            return *this;
+        }
+
+        // Read-modify-write in one walk: missing intermediates are created as Set does, then fn receives the
+        // target node by mutable reference. Returns false, without calling fn, for invalid or empty routes.
+        template <concepts::Route TRoute, std::invocable<NativeJson&> TFn>
+        bool Update(const TRoute& routeValue, TFn&& fn)
+        {
+            if (!UpdateAt(Root, routeValue, std::forward<TFn>(fn)))
+            {
+                return false;
+            }
+            ++Generation;
+            return true;
+        }
+
+        // Returns the node at routeValue, first storing defaultValue there if the node is missing or null.
+        // The pointer stays valid until the next structural change; nullptr for invalid or empty routes. It is
+        // read-only so every write goes through Set or Update and is seen by bound routes. A hit on an existing
+        // value changes nothing, so bound routes stay resolved.
+        template <concepts::Route TRoute, typename T>
+        [[nodiscard]] const NativeJson* GetOrInsert(const TRoute& routeValue, T&& defaultValue)
+        {
+            bool        changed = false;
+            NativeJson* slot    = GetOrInsertAt(Root, routeValue, std::forward<T>(defaultValue), changed);
+            if (changed)
+            {
+                ++Generation;
+            }
+            return slot;
+        }
+
+        // Moves the value at routeValue out of the document instead of copying it. Json, nlohmann::json and
+        // std::string targets are moved; other types are converted and the node is then cleared. On a missing
+        // node or failed conversion the document is left untouched.
+        template <typename T, concepts::Route TRoute>
+        [[nodiscard]] std::optional<T> Take(const TRoute& routeValue, TakeMode mode = TakeMode::LeaveNull) noexcept
+        {
+            auto value = TakeAt<T>(Root, routeValue, mode);
+            if (value.has_value())
+            {
+                ++Generation;
             }
+            return value;
+        }
+
+        // T may be std::string_view or const std::string* to borrow a string from the document instead of
+        // copying it; the result stays valid until the next mutation of this Json.
+        template <typename T>
+        [[nodiscard]] std::optional<T> TryGet(std::string_view key) const noexcept
+        {
+            return TryGetAt<T>(Root, key);
         }
 
         template <typename T>
@@ -90,24 +411,7 @@ namespace charted
         template <typename T, concepts::Route TRoute>
         [[nodiscard]] std::optional<T> TryGet(const TRoute& routeValue) const noexcept
         {
-            if (!IsRouteValid(routeValue))
-            {
-                return std::nullopt;
-            }
-
-            try
-            {
-                const NativeJson* found = FindPath(Root, routeValue);
-                if (found == nullptr)
-                {
-                    return std::nullopt;
-                }
-                return FromNative<T>(*found);
-            }
-            catch (...)
-            {
-                return std::nullopt;
-            }
+            return TryGetAt<T>(Root, routeValue);
         }
 
         template <typename T, concepts::Route TRoute>
@@ -117,16 +421,118 @@ namespace charted
             return value.has_value() ? std::move(value.value()) : std::move(defaultValue);
         }
 
-        [[nodiscard]] NativeJson& GetNative() noexcept { return Root; }
+        // Assigns the value into out instead of returning a new object, so strings and vectors keep their
+        // capacity across calls. Returns false and leaves out untouched on a miss or type mismatch.
+        template <typename T>
+        bool GetInto(std::string_view key, T& out) const
+        {
+            return AssignFrom(FindMember(Root, key), out);
+        }
+
+        template <typename T, concepts::Route TRoute>
+        bool GetInto(const TRoute& routeValue, T& out) const
+        {
+            return AssignFrom(IsRouteValid(routeValue) ? FindPath(Root, routeValue) : nullptr, out);
+        }
+
+        // Like Get, but the default is only built on a miss.
+        template <typename T, std::invocable TFallback>
+        [[nodiscard]] T GetOrElse(std::string_view key, TFallback&& fallback) const
+        {
+            auto value = TryGet<T>(key);
+            return value.has_value() ? std::move(value.value()) : T(std::invoke(std::forward<TFallback>(fallback)));
+        }
+
+        template <typename T, concepts::Route TRoute, std::invocable TFallback>
+        [[nodiscard]] T GetOrElse(const TRoute& routeValue, TFallback&& fallback) const
+        {
+            auto value = TryGet<T>(routeValue);
+            return value.has_value() ? std::move(value.value()) : T(std::invoke(std::forward<TFallback>(fallback)));
+        }
+
+        // Reads many routes in one pass. A route resolves the prefix it shares with the previous route only once,
+        // so pass routes sorted (or at least grouped by prefix); an unsorted batch degrades to one walk from the
+        // root per route. Only the first 32 levels are shared. Routes and outputs are matched by position;
+        // returns how many outputs were filled.
+        template <std::ranges::random_access_range TRoutes, std::ranges::random_access_range TOutputs>
+            requires concepts::Route<std::ranges::range_value_t<TRoutes>> &&
+                     detail::IsOptional<std::ranges::range_value_t<TOutputs>>::value
+        std::size_t GetMany(const TRoutes& routes, TOutputs&& outputs) const noexcept
+        {
+            PrefixWalker      walker(Root);
+            std::size_t       found = 0;
+            const std::size_t count = std::min<std::size_t>(std::ranges::size(routes), std::ranges::size(outputs));
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                found += ConvertInto(walker.Find(std::ranges::begin(routes)[i]), std::ranges::begin(outputs)[i]) ? 1 : 0;
+            }
+            return found;
+        }
+
+        // Heterogeneous form: any mix of route types, e.g. std::forward_as_tuple(nameRoute, route<"A.B">()),
+        // each read into the std::optional at the same position of outputs.
+        template <typename... TRoutes, typename... T>
+            requires (sizeof...(TRoutes) == sizeof...(T) && (concepts::Route<std::remove_cvref_t<TRoutes>> && ...))
+        std::size_t GetMany(const std::tuple<TRoutes...>& routes, std::tuple<std::optional<T>...>& outputs) const noexcept
+        {
+            PrefixWalker walker(Root);
+            std::size_t  found = 0;
+            [&]<std::size_t... I>(std::index_sequence<I...>)
+            {
+                ((found += ConvertInto(walker.Find(std::get<I>(routes)), std::get<I>(outputs)) ? 1 : 0), ...);
+            }(std::index_sequence_for<TRoutes...>{});
+            return found;
+        }
+
+        // Non-owning view of the node at routeValue; reads and writes through it take routes relative to
+        // that node and never copy the subtree. Invalid when the node does not exist. Like a pointer into
+        // the document, a view is invalidated by structural changes above its node.
+        template <concepts::Route TRoute>
+        [[nodiscard]] JsonConstRef At(const TRoute& routeValue) const noexcept;
+
+        template <concepts::Route TRoute>
+        [[nodiscard]] JsonRef At(const TRoute& routeValue) noexcept;
+
+        // Resolves routeValue once; the handle re-walks the path only after this document changes.
+        template <concepts::Route TRoute>
+        [[nodiscard]] BoundRoute<std::remove_cvref_t<TRoute>> Bind(TRoute&& routeValue) const
+        {
+            return BoundRoute<std::remove_cvref_t<TRoute>>(*this, std::forward<TRoute>(routeValue));
+        }
+
+        // Mutable access may change anything, so it invalidates bound routes conservatively.
+        [[nodiscard]] NativeJson& GetNative() noexcept
+        {
+            ++Generation;
+            return Root;
+        }
         [[nodiscard]] const NativeJson& GetNative() const noexcept { return Root; }
 
+        // Bumped by every mutation through this Json.
+        [[nodiscard]] std::uint64_t GetGeneration() const noexcept { return Generation; }
+
     private:
+        // Only an rvalue container owns its elements. Views and borrowed ranges such as std::span refer to
+        // the caller's storage even as prvalues, so their elements are copied.
+        template <typename TRange>
+        static constexpr bool MovesElements = !std::is_lvalue_reference_v<TRange> &&
+            !std::ranges::borrowed_range<TRange> && !std::ranges::view<std::remove_cvref_t<TRange>>;
+
         template <typename T>
         [[nodiscard]] static NativeJson ToNative(T&& value)
         {
             if constexpr (std::same_as<std::remove_cvref_t<T>, Json>)
             {
-                return value.GetNative();
+                // An rvalue Json hands over its tree; handles bound to it see the change.
+                if constexpr (!std::is_lvalue_reference_v<T> && !std::is_const_v<std::remove_reference_t<T>>)
+                {
+                    ++value.Generation;
+                    return std::move(value.Root);
+                }
+                else
+                {
+                    return value.Root;
+                }
             }
             else if constexpr (std::same_as<std::remove_cvref_t<T>, std::string_view>)
             {
@@ -145,161 +551,1140 @@ namespace charted
             {
                 return std::optional<T>{ T(value) };
             }
+            else if constexpr (std::same_as<T, bool>)
+            {
+                const auto* flag = value.template get_ptr<const NativeJson::boolean_t*>();
+                return (flag != nullptr) ? std::optional<T>{ *flag } : std::nullopt;
+            }
+            else if constexpr (std::same_as<T, std::string>)
+            {
+                const auto* text = value.template get_ptr<const NativeJson::string_t*>();
+                return (text != nullptr) ? std::optional<T>{ *text } : std::nullopt;
+            }
+            else if constexpr (std::same_as<T, std::string_view>)
+            {
+                const auto* text = value.template get_ptr<const NativeJson::string_t*>();
+                return (text != nullptr) ? std::optional<T>{ std::string_view(*text) } : std::nullopt;
+            }
+            else if constexpr (std::same_as<T, const std::string*>)
+            {
+                const auto* text = value.template get_ptr<const NativeJson::string_t*>();
+                return (text != nullptr) ? std::optional<T>{ text } : std::nullopt;
+            }
+            else if constexpr (std::is_arithmetic_v<T>)
+            {
+                return NumberFromNative<T>(value);
+            }
             else
             {
+                // nlohmann's from_json throws on a mismatch (and aborts without exceptions), so reject the
+                // shapes it would refuse before calling it.
+                if (!CanConvertFrom<T>(value))
+                {
+                    return std::nullopt;
+                }
                 return std::optional<T>{ value.template get<T>() };
             }
         }
 
-        template <concepts::Route TRoute>
-        static bool IsRouteValid(const TRoute& routeValue)
+        // Mirrors what nlohmann's from_json accepts for standard containers, element by element. Other types
+        // (pairs, optionals, types with a user-provided from_json) are assumed to accept any value and rely on
+        // ConvertNative catching a mismatch, so without exceptions they are rejected at compile time.
+        template <typename T>
+        [[nodiscard]] static bool CanConvertFrom(const NativeJson& value) noexcept
         {
-            if constexpr (concepts::IsStaticRoute<std::remove_cvref_t<TRoute>>::value)
+            if constexpr (std::same_as<T, NativeJson> || std::same_as<T, Json>)
             {
-                return std::remove_cvref_t<TRoute>::Valid;
+                return true;
             }
-            else if constexpr (requires { { routeValue.IsValid() } -> std::convertible_to<bool>; })
+            else if constexpr (std::same_as<T, bool>)
             {
-                return static_cast<bool>(routeValue.IsValid());
+                return value.is_boolean();
             }
-            else
+            else if constexpr (std::same_as<T, std::string>)
             {
-                return true;
+                return value.is_string();
             }
-        }
-
-        template <concepts::Route TRoute>
-        Json& SetPathValue(const TRoute& routeValue, NativeJson value)
-        {
-            const auto tokens = routeValue.GetTokens();
-            if (tokens.empty())
+            else if constexpr (std::is_arithmetic_v<T>)
             {
-                return *this;
+                return value.is_number() || value.is_boolean();
             }
-
-            if (!Root.is_object())
+            else if constexpr (detail::IsStdArray<T>::value)
             {
-                Root = NativeJson::object();
+                return value.is_array() && value.size() >= std::tuple_size_v<T> &&
+                       std::all_of(value.begin(), value.end(), [](const NativeJson& element)
+                       {
+                           return CanConvertFrom<typename T::value_type>(element);
+                       });
             }
-
-            NativeJson* current = std::addressof(Root);
-            for (std::size_t i = 0; i + 1 < tokens.size(); ++i)
+            else if constexpr (requires
+                               {
+                                   typename T::mapped_type;
+                                   requires std::constructible_from<typename T::key_type, std::string>;
+                               })
             {
-                const RouteToken& token = tokens[i];
-                const RouteToken& next  = tokens[i + 1];
-
-                if (token.Type == RouteTokenType::Key)
-                {
-                    if (!current->is_object())
-                    {
-                        *current = NativeJson::object();
-                    }
-                    const std::string key(token.GetString());
-                    NativeJson& child = (*current)[key];
-                    if (next.Type == RouteTokenType::Key)
-                    {
-                        if (!child.is_object())
-                        {
-                            child = NativeJson::object();
-                        }
-                    }
-                    else if (!child.is_array())
-                    {
-                        child = NativeJson::array();
-                    }
-                    current = std::addressof(child);
-                }
-                else
+                return value.is_object() && std::all_of(value.begin(), value.end(), [](const NativeJson& member)
                 {
-                    if (!current->is_array())
-                    {
-                        *current = NativeJson::array();
-                    }
-                    while (token.Index >= current->size())
-                    {
-                        current->push_back(NativeJson{});
-                    }
-                    NativeJson& child = (*current)[token.Index];
-                    if (next.Type == RouteTokenType::Key)
-                    {
-                        if (!child.is_object())
-                        {
-                            child = NativeJson::object();
-                        }
-                    }
-                    else if (!child.is_array())
-                    {
-                        child = NativeJson::array();
-                    }
-                    current = std::addressof(child);
-                }
+                    return CanConvertFrom<typename T::mapped_type>(member);
+                });
             }
-
-            const RouteToken& last = tokens.back();
-            if (last.Type == RouteTokenType::Key)
+            else if constexpr (std::ranges::range<T> && requires { typename T::value_type; })
             {
-                if (!current->is_object())
+                return value.is_array() && std::all_of(value.begin(), value.end(), [](const NativeJson& element)
                 {
-                    *current = NativeJson::object();
-                }
-                const std::string key(last.GetString());
-                (*current)[key] = std::move(value);
+                    return CanConvertFrom<typename T::value_type>(element);
+                });
             }
             else
             {
-                if (!current->is_array())
-                {
-                    *current = NativeJson::array();
-                }
-                while (last.Index >= current->size())
+#if CHARTED_HAS_EXCEPTIONS
+                return true;
+#else
+                static_assert(detail::DependentFalse<T>, "Without exceptions a mismatch cannot be detected for this type; read it as Json or a standard type instead.");
+                return false;
+#endif
+            }
+        }
+
+        // The single place a conversion may throw: only a user-provided from_json or an allocation failure can.
+        template <typename T>
+        [[nodiscard]] static std::optional<T> ConvertNative(const NativeJson& value) noexcept
+        {
+#if CHARTED_HAS_EXCEPTIONS
+            try
+            {
+                return FromNative<T>(value);
+            }
+            catch (...)
+            {
+                return std::nullopt;
+            }
+#else
+            return FromNative<T>(value);
+#endif
+        }
+
+        [[nodiscard]] static std::string DumpNative(const NativeJson& value, bool pretty)
+        {
+            return value.dump(pretty ? 4 : -1, ' ', false, NativeJson::error_handler_t::replace);
+        }
+
+        [[nodiscard]] static const NativeJson* FindMember(const NativeJson& node, std::string_view key) noexcept
+        {
+            const auto it = node.find(key);
+            return it != node.end() ? std::addressof(*it) : nullptr;
+        }
+
+        // Sequences assigned element by element so both the container and its elements keep their storage.
+        template <typename T>
+        static constexpr bool IsReusableSequence = !std::same_as<T, std::string> && requires(T& sequence, std::size_t n)
+        {
+            sequence.resize(n);
+            { sequence[n] } -> std::same_as<typename T::value_type&>;
+        };
+
+        // Checked up front so a failed GetInto leaves its target untouched.
+        template <typename T>
+        [[nodiscard]] static bool CanAssignFrom(const NativeJson& value) noexcept
+        {
+            if constexpr (std::is_arithmetic_v<T> && !std::same_as<T, bool>)
+            {
+                return NumberFromNative<T>(value).has_value();
+            }
+            else if constexpr (IsReusableSequence<T>)
+            {
+                return value.is_array() && std::all_of(value.begin(), value.end(), [](const NativeJson& element)
                 {
-                    current->push_back(NativeJson{});
-                }
-                (*current)[last.Index] = std::move(value);
+                    return CanAssignFrom<typename T::value_type>(element);
+                });
+            }
+            else
+            {
+                return CanConvertFrom<T>(value);
             }
+        }
 
-            return *this;
+        // Requires CanAssignFrom<T>(value).
+        template <typename T>
+        static void AssignChecked(const NativeJson& value, T& out)
+        {
+            if constexpr (std::is_arithmetic_v<T> && !std::same_as<T, bool>)
+            {
+                out = *NumberFromNative<T>(value);
+            }
+            else if constexpr (std::same_as<T, bool>)
+            {
+                out = *value.template get_ptr<const NativeJson::boolean_t*>();
+            }
+            else if constexpr (std::same_as<T, std::string>)
+            {
+                out.assign(*value.template get_ptr<const NativeJson::string_t*>());
+            }
+            else if constexpr (IsReusableSequence<T>)
+            {
+                out.resize(value.size());
+                std::size_t index = 0;
+                for (const NativeJson& element : value)
+                {
+                    AssignChecked(element, out[index++]);
+                }
+            }
+            else
+            {
+                out = *FromNative<T>(value);
+            }
         }
 
-        template <concepts::Route TRoute>
-        [[nodiscard]] static const NativeJson* FindPath(const NativeJson& root, const TRoute& routeValue) noexcept
+        template <typename T>
+        static bool AssignFrom(const NativeJson* node, T& out)
         {
-            const auto tokens = routeValue.GetTokens();
-            const NativeJson* current = std::addressof(root);
+            if (node == nullptr)
+            {
+                return false;
+            }
+            if constexpr (std::is_arithmetic_v<T> || std::same_as<T, std::string> || IsReusableSequence<T>)
+            {
+                if (!CanAssignFrom<T>(*node))
+                {
+                    return false;
+                }
+                AssignChecked(*node, out);
+                return true;
+            }
+            else
+            {
+                // No storage to reuse: convert, then move into place.
+                auto value = ConvertNative<T>(*node);
+                if (!value.has_value())
+                {
+                    return false;
+                }
+                out = std::move(*value);
+                return true;
+            }
+        }
 
-            for (const RouteToken& token : tokens)
+        // std::in_range only accepts standard integer types, so character types are checked through the
+        // integer type of the same size and signedness.
+        template <typename T>
+        using RangeCheckType = std::conditional_t<std::is_signed_v<T>, std::make_signed_t<T>, std::make_unsigned_t<T>>;
+
+        // Checks the stored type before converting, so a mismatch costs a branch instead of a type_error.
+        // Accepts the same sources as nlohmann's arithmetic get (numbers and booleans), but rejects integers
+        // that do not fit T instead of wrapping them.
+        template <typename T>
+        [[nodiscard]] static std::optional<T> NumberFromNative(const NativeJson& value) noexcept
+        {
+            switch (value.type())
             {
-                if (token.Type == RouteTokenType::Key)
+                case NativeJson::value_t::number_integer:
                 {
-                    if (!current->is_object())
+                    const auto number = *value.template get_ptr<const NativeJson::number_integer_t*>();
+                    if constexpr (std::is_integral_v<T>)
                     {
-                        return nullptr;
+                        if (!std::in_range<RangeCheckType<T>>(number))
+                        {
+                            return std::nullopt;
+                        }
                     }
-                    const std::string key(token.GetString());
-                    const auto it = current->find(key);
-                    if (it == current->end())
+                    return static_cast<T>(number);
+                }
+                case NativeJson::value_t::number_unsigned:
+                {
+                    const auto number = *value.template get_ptr<const NativeJson::number_unsigned_t*>();
+                    if constexpr (std::is_integral_v<T>)
                     {
-                        return nullptr;
+                        if (!std::in_range<RangeCheckType<T>>(number))
+                        {
+                            return std::nullopt;
+                        }
                     }
-                    current = std::addressof(*it);
+                    return static_cast<T>(number);
                 }
-                else
+                case NativeJson::value_t::number_float:
                 {
-                    if (!current->is_array())
+                    const auto number = *value.template get_ptr<const NativeJson::number_float_t*>();
+                    if constexpr (std::is_integral_v<T>)
                     {
-                        return nullptr;
+                        // Truncates like a cast, but only when the result is representable.
+                        const double truncated = std::trunc(static_cast<double>(number));
+                        const double limit     = std::ldexp(1.0, std::numeric_limits<T>::digits);
+                        const double lowest    = std::is_signed_v<T> ? -limit : 0.0;
+                        if (!(truncated >= lowest && truncated < limit))
+                        {
+                            return std::nullopt;
+                        }
+                        return static_cast<T>(truncated);
                     }
-                    if (token.Index >= current->size())
+                    else
                     {
-                        return nullptr;
+                        return static_cast<T>(number);
                     }
-                    current = std::addressof((*current)[token.Index]);
                 }
+                case NativeJson::value_t::boolean:
+                    return static_cast<T>(*value.template get_ptr<const NativeJson::boolean_t*>());
+                default:
+                    return std::nullopt;
+            }
+        }
+
+        template <concepts::Route TRoute>
+        static bool IsRouteValid(const TRoute& routeValue)
+        {
+            if constexpr (concepts::IsStaticRoute<std::remove_cvref_t<TRoute>>::value)
+            {
+                return std::remove_cvref_t<TRoute>::Valid;
+            }
+            else if constexpr (requires { { routeValue.IsValid() } -> std::convertible_to<bool>; })
+            {
+                return static_cast<bool>(routeValue.IsValid());
+            }
+            else
+            {
+                return true;
+            }
+        }
+
+        // Returns the member slot for key, allocating the key string only when it is inserted.
+        [[nodiscard]] static NativeJson& ObjectSlot(NativeJson& node, std::string_view key)
+        {
+            if (!node.is_object())
+            {
+                node = NativeJson::object();
+            }
+
+            // One tree walk: lower_bound finds the member or the insertion hint for it.
+            auto& object = *node.template get_ptr<NativeJson::object_t*>();
+            const auto it = object.lower_bound(key);
+            if (it != object.end() && it->first == key)
+            {
+                return it->second;
+            }
+            return object.emplace_hint(it, std::string(key), NativeJson{})->second;
+        }
+
+        // Returns the element slot at index, growing the array to fit in a single resize.
+        [[nodiscard]] static NativeJson& ArraySlot(NativeJson& node, std::size_t index)
+        {
+            if (!node.is_array())
+            {
+                node = NativeJson::array();
+            }
+
+            auto& array = *node.template get_ptr<NativeJson::array_t*>();
+            if (index >= array.size())
+            {
+                array.resize(index + 1);
+            }
+            return array[index];
+        }
+
+        // Node-relative implementations shared by Json and the JsonRef views. Mutators report whether they
+        // wrote, so the caller can bump the generation of the owning document.
+        template <typename T>
+        [[nodiscard]] static std::optional<T> TryGetAt(const NativeJson& node, std::string_view key) noexcept
+        {
+            const NativeJson* member = FindMember(node, key);
+            return member != nullptr ? ConvertNative<T>(*member) : std::nullopt;
+        }
+
+        template <typename T, concepts::Route TRoute>
+        [[nodiscard]] static std::optional<T> TryGetAt(const NativeJson& node, const TRoute& routeValue) noexcept
+        {
+            if (!IsRouteValid(routeValue))
+            {
+                return std::nullopt;
+            }
+
+            const NativeJson* found = FindPath(node, routeValue);
+            if (found == nullptr)
+            {
+                return std::nullopt;
+            }
+            return ConvertNative<T>(*found);
+        }
+
+        static void SetAt(NativeJson& node, std::string_view key, NativeJson value)
+        {
+            ObjectSlot(node, key) = std::move(value);
+        }
+
+        template <concepts::Route TRoute>
+        static bool SetAt(NativeJson& node, const TRoute& routeValue, NativeJson value)
+        {
+            NativeJson* slot = PathSlot(node, routeValue);
+            if (slot == nullptr)
+            {
+                return false;
+            }
+            *slot = std::move(value);
+            return true;
+        }
+
+        template <concepts::Route TRoute, typename TFn>
+        static bool UpdateAt(NativeJson& node, const TRoute& routeValue, TFn&& fn)
+        {
+            if (!IsRouteValid(routeValue))
+            {
+                return false;
+            }
+
+            NativeJson* slot = PathSlot(node, routeValue);
+            if (slot == nullptr)
+            {
+                return false;
+            }
+            std::invoke(std::forward<TFn>(fn), *slot);
+            return true;
+        }
+
+        template <concepts::Route TRoute, typename T>
+        // changed is set only when defaultValue is stored. A walk that ends on an existing non-null node went
+        // through existing nodes only, so it created nothing.
+        [[nodiscard]] static NativeJson* GetOrInsertAt(
+            NativeJson& node, const TRoute& routeValue, T&& defaultValue, bool& changed)
+        {
+            if (!IsRouteValid(routeValue))
+            {
+                return nullptr;
+            }
+
+            NativeJson* slot = PathSlot(node, routeValue);
+            if (slot != nullptr && slot->is_null())
+            {
+                *slot   = ToNative(std::forward<T>(defaultValue));
+                changed = true;
+            }
+            return slot;
+        }
+
+        template <typename T, concepts::Route TRoute>
+        [[nodiscard]] static std::optional<T> TakeAt(NativeJson& node, const TRoute& routeValue, TakeMode mode) noexcept
+        {
+            static_assert(!detail::BorrowedValue<T>, "Take removes the node; a borrowed result would dangle.");
+            if (!IsRouteValid(routeValue))
+            {
+                return std::nullopt;
+            }
+
+            const auto        tokens = detail::GetRouteTokens(routeValue);
+            const std::size_t count  = tokens.size();
+            if (count == 0)
+            {
+                return std::nullopt;
+            }
+
+            // FindStep only reads; the parent is reached from a mutable node, so it is mutable too.
+            NativeJson* parent = std::addressof(node);
+            for (std::size_t i = 0; i + 1 < count && parent != nullptr; ++i)
+            {
+                parent = const_cast<NativeJson*>(FindStep(*parent, tokens[i]));
+            }
+            if (parent == nullptr)
+            {
+                return std::nullopt;
+            }
+
+            const RouteToken last = tokens[count - 1];
+            if (last.Type == RouteTokenType::Key)
+            {
+                auto* object = parent->template get_ptr<NativeJson::object_t*>();
+                if (object == nullptr)
+                {
+                    return std::nullopt;
+                }
+                const auto it = object->find(last.GetString());
+                if (it == object->end())
+                {
+                    return std::nullopt;
+                }
+
+                auto value = MoveOut<T>(it->second);
+                if (value.has_value() && mode == TakeMode::Erase)
+                {
+                    object->erase(it);
+                }
+                else if (value.has_value())
+                {
+                    it->second = nullptr;
+                }
+                return value;
+            }
+
+            auto* array = parent->template get_ptr<NativeJson::array_t*>();
+            if (array == nullptr || last.Index >= array->size())
+            {
+                return std::nullopt;
+            }
+            auto value = MoveOut<T>((*array)[last.Index]);
+            if (value.has_value() && mode == TakeMode::Erase)
+            {
+                array->erase(array->begin() + static_cast<std::ptrdiff_t>(last.Index));
+            }
+            else if (value.has_value())
+            {
+                (*array)[last.Index] = nullptr;
+            }
+            return value;
+        }
+
+        template <typename T>
+        [[nodiscard]] static std::optional<T> MoveOut(NativeJson& value) noexcept
+        {
+            if constexpr (std::same_as<T, Json>)
+            {
+                return std::optional<T>{ T(std::move(value)) };
+            }
+            else if constexpr (std::same_as<T, NativeJson>)
+            {
+                return std::optional<T>{ std::move(value) };
+            }
+            else if constexpr (std::same_as<T, std::string>)
+            {
+                auto* text = value.template get_ptr<std::string*>();
+                return (text != nullptr) ? std::optional<T>{ std::move(*text) } : std::nullopt;
+            }
+            else
+            {
+                return ConvertNative<T>(value);
+            }
+        }
+
+        // Walks routeValue once from node, creating missing intermediates; nullptr for routes without tokens.
+        template <concepts::Route TRoute>
+        [[nodiscard]] static NativeJson* PathSlot(NativeJson& node, const TRoute& routeValue)
+        {
+            const auto tokens = detail::GetRouteTokens(routeValue);
+            if (tokens.empty())
+            {
+                return nullptr;
             }
 
+            NativeJson* current = std::addressof(node);
+            for (const RouteToken& token : tokens)
+            {
+                current = (token.Type == RouteTokenType::Key)
+                    ? std::addressof(ObjectSlot(*current, token.GetString()))
+                    : std::addressof(ArraySlot(*current, token.Index));
+            }
             return current;
         }
 
-        NativeJson Root;
+        template <concepts::Route TRoute>
+        [[nodiscard]] static const NativeJson* FindPath(const NativeJson& root, const TRoute& routeValue) noexcept
+        {
+            if constexpr (concepts::IsStaticRoute<std::remove_cvref_t<TRoute>>::value)
+            {
+                return FindStaticPath<std::remove_cvref_t<TRoute>>(
+                    root, routeValue, std::make_index_sequence<std::remove_cvref_t<TRoute>::TokenCount>{});
+            }
+            else if constexpr (concepts::IsBoundStaticRoute<std::remove_cvref_t<TRoute>>::value)
+            {
+                using TStaticRoute = typename std::remove_cvref_t<TRoute>::StaticRouteType;
+                return FindStaticPath<TStaticRoute>(
+                    root, routeValue, std::make_index_sequence<TStaticRoute::TokenCount>{});
+            }
+            else if constexpr (detail::PackedTokenRoute<TRoute>)
+            {
+                return FindPackedPath(root, routeValue.GetTokens(), routeValue.GetPathString().data());
+            }
+            else
+            {
+                const NativeJson* current = std::addressof(root);
+                for (const RouteToken& token : detail::GetRouteTokens(routeValue))
+                {
+                    current = FindStep(*current, token);
+                    if (current == nullptr)
+                    {
+                        return nullptr;
+                    }
+                }
+
+                return current;
+            }
+        }
+
+        // Reads packed tokens in place instead of unpacking them: key text comes from the path by offset and
+        // the index from Value. Shared by every route type that stores PackedRouteTokens.
+        [[nodiscard]] static const NativeJson* FindPackedPath(
+            const NativeJson& root, std::span<const PackedRouteToken> tokens, const char* base) noexcept
+        {
+            const NativeJson* current = std::addressof(root);
+            for (const PackedRouteToken& token : tokens)
+            {
+                if ((token.LengthAndType & PackedRouteToken::IndexFlag) != 0)
+                {
+                    current = FindIndexStep(*current, token.Value);
+                }
+                else
+                {
+                    // The index flag is clear, so LengthAndType is the key length.
+                    current = FindKeyStep(*current, std::string_view(base + token.Offset, token.LengthAndType));
+                }
+                if (current == nullptr)
+                {
+                    return nullptr;
+                }
+            }
+            return current;
+        }
+
+        [[nodiscard]] static const NativeJson* FindStep(const NativeJson& node, const RouteToken& token) noexcept
+        {
+            return (token.Type == RouteTokenType::Key) ? FindKeyStep(node, token.GetString()) : FindIndexStep(node, token.Index);
+        }
+
+        [[nodiscard]] static const NativeJson* FindKeyStep(const NativeJson& node, std::string_view key) noexcept
+        {
+            // object_t uses a transparent comparator, so the key view is compared in place.
+            const auto* object = node.template get_ptr<const NativeJson::object_t*>();
+            if (object == nullptr)
+            {
+                return nullptr;
+            }
+            const auto it = object->find(key);
+            return (it != object->end()) ? std::addressof(it->second) : nullptr;
+        }
+
+        [[nodiscard]] static const NativeJson* FindIndexStep(const NativeJson& node, std::uint32_t index) noexcept
+        {
+            const auto* array = node.template get_ptr<const NativeJson::array_t*>();
+            return (array != nullptr && index < array->size()) ? std::addressof((*array)[index]) : nullptr;
+        }
+
+        // Resolves a sequence of routes, reusing the nodes of the token prefix shared with the previous route.
+        // Only the first MaxDepth levels are remembered; deeper tokens are walked per route.
+        class PrefixWalker
+        {
+        public:
+            static constexpr std::size_t MaxDepth = 32;
+
+            explicit PrefixWalker(const NativeJson& root) noexcept
+            {
+                Nodes[0] = std::addressof(root);
+            }
+
+            template <concepts::Route TRoute>
+            [[nodiscard]] const NativeJson* Find(const TRoute& routeValue) noexcept
+            {
+                if (!IsRouteValid(routeValue))
+                {
+                    return nullptr;
+                }
+
+                const auto        tokens = detail::GetRouteTokens(routeValue);
+                const std::size_t count  = tokens.size();
+
+                std::size_t depth = 0;
+                while (depth < count && depth < Depth && tokens[depth] == Tokens[depth])
+                {
+                    ++depth;
+                }
+
+                const NativeJson* current = Nodes[depth];
+                for (std::size_t i = depth; i < count && current != nullptr; ++i)
+                {
+                    const RouteToken token = tokens[i];
+                    current = FindStep(*current, token);
+                    if (i < MaxDepth)
+                    {
+                        Tokens[i]    = token;
+                        Nodes[i + 1] = current;
+                        depth        = i + 1;
+                    }
+                }
+                Depth = depth;
+                return current;
+            }
+
+        private:
+            std::array<const NativeJson*, MaxDepth + 1> Nodes{};
+            std::array<RouteToken, MaxDepth>            Tokens{};
+            std::size_t                                 Depth{ 0 };
+        };
+
+        // Write-side counterpart of PrefixWalker. A step only touches descendants of the node it runs on, so
+        // nodes on the previous route's path stay valid; Depth never exceeds the current route's length, so
+        // a node replaced by a shorter route's value is never reused.
+        class SlotWalker
+        {
+        public:
+            static constexpr std::size_t MaxDepth = PrefixWalker::MaxDepth;
+
+            explicit SlotWalker(NativeJson& root) noexcept
+            {
+                Nodes[0] = std::addressof(root);
+            }
+
+            // Returns the slot for routeValue, creating containers along the way; nullptr for invalid or empty routes.
+            template <concepts::Route TRoute>
+            [[nodiscard]] NativeJson* Slot(const TRoute& routeValue)
+            {
+                if (!IsRouteValid(routeValue))
+                {
+                    return nullptr;
+                }
+
+                const auto        tokens = detail::GetRouteTokens(routeValue);
+                const std::size_t count  = tokens.size();
+                if (count == 0)
+                {
+                    return nullptr;
+                }
+
+                std::size_t depth = 0;
+                while (depth < count && depth < Depth && tokens[depth] == Tokens[depth])
+                {
+                    ++depth;
+                }
+
+                NativeJson* current = Nodes[depth];
+                Depth = depth;
+                for (std::size_t i = depth; i < count; ++i)
+                {
+                    const RouteToken token = tokens[i];
+                    current = (token.Type == RouteTokenType::Key)
+                        ? std::addressof(ObjectSlot(*current, token.GetString()))
+                        : std::addressof(ArraySlot(*current, token.Index));
+                    if (i < MaxDepth)
+                    {
+                        Tokens[i]    = token;
+                        Nodes[i + 1] = current;
+                        Depth        = i + 1;
+                    }
+                }
+                return current;
+            }
+
+            template <concepts::Route TRoute>
+            void Assign(const TRoute& routeValue, NativeJson value)
+            {
+                if (NativeJson* slot = Slot(routeValue))
+                {
+                    *slot = std::move(value);
+                }
+            }
+
+        private:
+            std::array<NativeJson*, MaxDepth + 1> Nodes{};
+            std::array<RouteToken, MaxDepth>      Tokens{};
+            std::size_t                           Depth{ 0 };
+        };
+
+        template <typename T>
+        [[nodiscard]] static bool ConvertInto(const NativeJson* node, std::optional<T>& output) noexcept
+        {
+            output.reset();
+            if (node == nullptr)
+            {
+                return false;
+            }
+
+            output = ConvertNative<T>(*node);
+            return output.has_value();
+        }
+
+        // Static routes expand into a straight-line chain of steps with keys and indices as constants.
+        // Only [$] placeholders of a bound route are read from routeValue at runtime.
+        template <typename TStaticRoute, typename TRoute, std::size_t... I>
+        [[nodiscard]] static const NativeJson* FindStaticPath(
+            const NativeJson& root, const TRoute& routeValue, std::index_sequence<I...>) noexcept
+        {
+            const NativeJson* current = std::addressof(root);
+            (void)(((current = FindStaticStep<TStaticRoute, I>(*current, routeValue)) != nullptr) && ...);
+            return current;
+        }
+
+        template <typename TStaticRoute, std::size_t I, typename TRoute>
+        [[nodiscard]] static const NativeJson* FindStaticStep(const NativeJson& node, const TRoute& routeValue) noexcept
+        {
+            constexpr RouteToken token = TStaticRoute::Parsed.Tokens[I];
+            if constexpr (token.Type == RouteTokenType::Key)
+            {
+                // Literal keys are never empty, so skip GetString()'s null check; GCC rejects that
+                // comparison in constant evaluation under -fsanitize=undefined.
+                constexpr std::string_view key(token.Ptr, token.Length);
+                const auto* object = node.template get_ptr<const NativeJson::object_t*>();
+                if (object == nullptr)
+                {
+                    return nullptr;
+                }
+                const auto it = object->find(key);
+                return (it != object->end()) ? std::addressof(it->second) : nullptr;
+            }
+            else
+            {
+                std::size_t index = token.Index;
+                if constexpr (TStaticRoute::Parsed.Holes[I])
+                {
+                    index = routeValue.template GetBoundIndex<I>();
+                }
+                const auto* array = node.template get_ptr<const NativeJson::array_t*>();
+                return (array != nullptr && index < array->size()) ? std::addressof((*array)[index]) : nullptr;
+            }
+        }
+
+        NativeJson    Root;
+        std::uint64_t Generation{ detail::NextGenerationSeed() };
+    };
+
+    struct JsonParseResult
+    {
+        std::optional<Json> Value;
+        JsonParseError      Error;
+
+        [[nodiscard]] bool IsOk() const noexcept { return Value.has_value(); }
+    };
+
+    inline JsonParseResult Json::TryParse(std::string_view jsonText) noexcept
+    {
+        detail::JsonParseErrorCapture capture(jsonText);
+        if (NativeJson::sax_parse(jsonText, &capture))
+        {
+            return JsonParseResult{ .Value = Json(std::move(capture.Root)), .Error = {} };
+        }
+
+        if (capture.Error.Kind == JsonParseErrorKind::None)
+        {
+            capture.Error.Kind = JsonParseErrorKind::Other;
+        }
+        return JsonParseResult{ .Value = std::nullopt, .Error = capture.Error };
+    }
+
+    // Read-only view of one node inside a Json. Routes passed to it are relative to that node.
+    class JsonConstRef
+    {
+        using NativeJson = nlohmann::json;
+
+        friend class Json;
+        friend class JsonRef;
+
+    public:
+        JsonConstRef() noexcept = default;
+
+        explicit JsonConstRef(const NativeJson* node) noexcept
+            : Node(node)
+        {
+        }
+
+        [[nodiscard]] bool IsValid() const noexcept { return Node != nullptr; }
+        [[nodiscard]] bool IsNull() const noexcept { return Node == nullptr || Node->is_null(); }
+        [[nodiscard]] bool Contains(std::string_view key) const noexcept { return Node != nullptr && Node->contains(key); }
+
+        [[nodiscard]] std::string Dump(bool pretty = true) const
+        {
+            return Node == nullptr ? std::string{} : Json::DumpNative(*Node, pretty);
+        }
+
+        template <typename T>
+        [[nodiscard]] std::optional<T> TryGet(std::string_view key) const noexcept
+        {
+            return Node != nullptr ? Json::TryGetAt<T>(*Node, key) : std::nullopt;
+        }
+
+        template <typename T>
+        [[nodiscard]] T Get(std::string_view key, T defaultValue = T{}) const
+        {
+            auto value = TryGet<T>(key);
+            return value.has_value() ? std::move(value.value()) : std::move(defaultValue);
+        }
+
+        template <typename T, concepts::Route TRoute>
+        [[nodiscard]] std::optional<T> TryGet(const TRoute& routeValue) const noexcept
+        {
+            return Node != nullptr ? Json::TryGetAt<T>(*Node, routeValue) : std::nullopt;
+        }
+
+        template <typename T, concepts::Route TRoute>
+        [[nodiscard]] T Get(const TRoute& routeValue, T defaultValue = T{}) const
+        {
+            auto value = TryGet<T>(routeValue);
+            return value.has_value() ? std::move(value.value()) : std::move(defaultValue);
+        }
+
+        template <typename T>
+        bool GetInto(std::string_view key, T& out) const
+        {
+            return Json::AssignFrom(Node != nullptr ? Json::FindMember(*Node, key) : nullptr, out);
+        }
+
+        template <typename T, concepts::Route TRoute>
+        bool GetInto(const TRoute& routeValue, T& out) const
+        {
+            return Json::AssignFrom(At(routeValue).Node, out);
+        }
+
+        template <typename T, std::invocable TFallback>
+        [[nodiscard]] T GetOrElse(std::string_view key, TFallback&& fallback) const
+        {
+            auto value = TryGet<T>(key);
+            return value.has_value() ? std::move(value.value()) : T(std::invoke(std::forward<TFallback>(fallback)));
+        }
+
+        template <typename T, concepts::Route TRoute, std::invocable TFallback>
+        [[nodiscard]] T GetOrElse(const TRoute& routeValue, TFallback&& fallback) const
+        {
+            auto value = TryGet<T>(routeValue);
+            return value.has_value() ? std::move(value.value()) : T(std::invoke(std::forward<TFallback>(fallback)));
+        }
+
+        template <concepts::Route TRoute>
+        [[nodiscard]] JsonConstRef At(const TRoute& routeValue) const noexcept
+        {
+            return JsonConstRef(
+                (Node != nullptr && Json::IsRouteValid(routeValue)) ? Json::FindPath(*Node, routeValue) : nullptr);
+        }
+
+        // Requires IsValid().
+        [[nodiscard]] const NativeJson& GetNative() const noexcept { return *Node; }
+
+    private:
+        const NativeJson* Node{ nullptr };
+    };
+
+    // Mutable view of one node inside a Json. Writes go to the node in place and bump the owning
+    // document's generation, so bound routes on that document re-resolve.
+    class JsonRef
+    {
+        using NativeJson = nlohmann::json;
+
+    public:
+        JsonRef() noexcept = default;
+
+        JsonRef(Json& owner, NativeJson* node) noexcept
+            : Owner(std::addressof(owner))
+            , Node(node)
+        {
+        }
+
+        [[nodiscard]] operator JsonConstRef() const noexcept { return JsonConstRef(Node); }
+
+        [[nodiscard]] bool IsValid() const noexcept { return Node != nullptr; }
+        [[nodiscard]] bool IsNull() const noexcept { return Node == nullptr || Node->is_null(); }
+        [[nodiscard]] bool Contains(std::string_view key) const noexcept { return AsConst().Contains(key); }
+        [[nodiscard]] std::string Dump(bool pretty = true) const { return AsConst().Dump(pretty); }
+
+        template <typename T>
+        JsonRef& Set(std::string_view key, T&& value)
+        {
+            if (Node != nullptr)
+            {
+                Json::SetAt(*Node, key, Json::ToNative(std::forward<T>(value)));
+                ++Owner->Generation;
+            }
+            return *this;
+        }
+
+        template <concepts::Route TRoute, typename T>
+        JsonRef& Set(const TRoute& routeValue, T&& value)
+        {
+            if (Node != nullptr && Json::IsRouteValid(routeValue) &&
+                Json::SetAt(*Node, routeValue, Json::ToNative(std::forward<T>(value))))
+            {
+                ++Owner->Generation;
+            }
+            return *this;
+        }
+
+        template <concepts::Route TRoute, std::invocable<NativeJson&> TFn>
+        bool Update(const TRoute& routeValue, TFn&& fn)
+        {
+            if (Node == nullptr || !Json::UpdateAt(*Node, routeValue, std::forward<TFn>(fn)))
+            {
+                return false;
+            }
+            ++Owner->Generation;
+            return true;
+        }
+
+        template <concepts::Route TRoute, typename T>
+        [[nodiscard]] const NativeJson* GetOrInsert(const TRoute& routeValue, T&& defaultValue)
+        {
+            if (Node == nullptr)
+            {
+                return nullptr;
+            }
+
+            bool        changed = false;
+            NativeJson* slot    = Json::GetOrInsertAt(*Node, routeValue, std::forward<T>(defaultValue), changed);
+            if (changed)
+            {
+                ++Owner->Generation;
+            }
+            return slot;
+        }
+
+        template <typename T, concepts::Route TRoute>
+        [[nodiscard]] std::optional<T> Take(const TRoute& routeValue, TakeMode mode = TakeMode::LeaveNull) noexcept
+        {
+            if (Node == nullptr)
+            {
+                return std::nullopt;
+            }
+
+            auto value = Json::TakeAt<T>(*Node, routeValue, mode);
+            if (value.has_value())
+            {
+                ++Owner->Generation;
+            }
+            return value;
+        }
+
+        template <typename T>
+        [[nodiscard]] std::optional<T> TryGet(std::string_view key) const noexcept
+        {
+            return AsConst().TryGet<T>(key);
+        }
+
+        template <typename T>
+        [[nodiscard]] T Get(std::string_view key, T defaultValue = T{}) const
+        {
+            return AsConst().Get<T>(key, std::move(defaultValue));
+        }
+
+        template <typename T, concepts::Route TRoute>
+        [[nodiscard]] std::optional<T> TryGet(const TRoute& routeValue) const noexcept
+        {
+            return AsConst().TryGet<T>(routeValue);
+        }
+
+        template <typename T, concepts::Route TRoute>
+        [[nodiscard]] T Get(const TRoute& routeValue, T defaultValue = T{}) const
+        {
+            return AsConst().Get<T>(routeValue, std::move(defaultValue));
+        }
+
+        template <typename T>
+        bool GetInto(std::string_view key, T& out) const
+        {
+            return AsConst().GetInto(key, out);
+        }
+
+        template <typename T, concepts::Route TRoute>
+        bool GetInto(const TRoute& routeValue, T& out) const
+        {
+            return AsConst().GetInto(routeValue, out);
+        }
+
+        template <typename T, std::invocable TFallback>
+        [[nodiscard]] T GetOrElse(std::string_view key, TFallback&& fallback) const
+        {
+            return AsConst().GetOrElse<T>(key, std::forward<TFallback>(fallback));
+        }
+
+        template <typename T, concepts::Route TRoute, std::invocable TFallback>
+        [[nodiscard]] T GetOrElse(const TRoute& routeValue, TFallback&& fallback) const
+        {
+            return AsConst().GetOrElse<T>(routeValue, std::forward<TFallback>(fallback));
+        }
+
+        template <concepts::Route TRoute>
+        [[nodiscard]] JsonRef At(const TRoute& routeValue) const noexcept
+        {
+            if (Node == nullptr)
+            {
+                return JsonRef{};
+            }
+            return JsonRef(*Owner, const_cast<NativeJson*>(AsConst().At(routeValue).Node));
+        }
+
+        // Requires IsValid(). Mutable access invalidates bound routes, as Json::GetNative() does.
+        [[nodiscard]] NativeJson& GetNative() const noexcept
+        {
+            ++Owner->Generation;
+            return *Node;
+        }
+
+    private:
+        [[nodiscard]] JsonConstRef AsConst() const noexcept { return JsonConstRef(Node); }
+
+        Json*       Owner{ nullptr };
+        NativeJson* Node{ nullptr };
+    };
+
+    template <concepts::Route TRoute>
+    JsonConstRef Json::At(const TRoute& routeValue) const noexcept
+    {
+        return JsonConstRef(IsRouteValid(routeValue) ? FindPath(Root, routeValue) : nullptr);
+    }
+
+    template <concepts::Route TRoute>
+    JsonRef Json::At(const TRoute& routeValue) noexcept
+    {
+        // The lookup is shared with the const path; Root is mutable here, so the node is too.
+        return JsonRef(*this, const_cast<NativeJson*>(std::as_const(*this).At(routeValue).Node));
+    }
+
+    // A route resolved against one Json. The target node is cached together with the document generation,
+    // so repeated reads cost a counter comparison plus the value conversion until the document changes.
+    // The Json must outlive the handle. A handle caches on read and is not safe to share across threads.
+    template <concepts::Route TRoute>
+    class BoundRoute
+    {
+        using NativeJson = Json::NativeJson;
+
+    public:
+        BoundRoute(const Json& document, TRoute routeValue)
+            : Document(std::addressof(document))
+            , Route(std::move(routeValue))
+        {
+            Resolve();
+        }
+
+        template <typename T>
+        [[nodiscard]] std::optional<T> TryGet() const noexcept
+        {
+            const NativeJson* node = GetNode();
+            if (node == nullptr)
+            {
+                return std::nullopt;
+            }
+
+            return Json::ConvertNative<T>(*node);
+        }
+
+        template <typename T>
+        [[nodiscard]] T Get(T defaultValue = T{}) const
+        {
+            auto value = TryGet<T>();
+            return value.has_value() ? std::move(value.value()) : std::move(defaultValue);
+        }
+
+        template <typename T>
+        bool GetInto(T& out) const
+        {
+            return Json::AssignFrom(GetNode(), out);
+        }
+
+        template <typename T, std::invocable TFallback>
+        [[nodiscard]] T GetOrElse(TFallback&& fallback) const
+        {
+            auto value = TryGet<T>();
+            return value.has_value() ? std::move(value.value()) : T(std::invoke(std::forward<TFallback>(fallback)));
+        }
+
+        [[nodiscard]] bool Exists() const noexcept { return GetNode() != nullptr; }
+        [[nodiscard]] const TRoute& GetRoute() const noexcept { return Route; }
+
+    private:
+        [[nodiscard]] const NativeJson* GetNode() const noexcept
+        {
+            if (Generation != Document->Generation)
+            {
+                Resolve();
+            }
+            return Node;
+        }
+
+        void Resolve() const noexcept
+        {
+            Node       = Json::IsRouteValid(Route) ? Json::FindPath(Document->Root, Route) : nullptr;
+            Generation = Document->Generation;
+        }
+
+        const Json*               Document;
+        TRoute                    Route;
+        mutable const NativeJson* Node{ nullptr };
+        mutable std::uint64_t     Generation{ 0 };
     };
 }
\ No newline at end of file
@@ -6,4 +6,10 @@ export module charted;
 export namespace charted
 {
     using ::charted::route;
+    using ::charted::RouteBuilder;
+    using ::charted::RouteCache;
+    using ::charted::RouteView;
+    using ::charted::PackedRoute;
+    using ::charted::CompactRoute;
+    using ::charted::InlineRouteView;
 }
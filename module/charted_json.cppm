@@ -6,4 +6,11 @@ export module charted.json;
 export namespace charted
 {
     using ::charted::Json;
+    using ::charted::BoundRoute;
+    using ::charted::JsonRef;
+    using ::charted::JsonConstRef;
+    using ::charted::TakeMode;
+    using ::charted::JsonParseError;
+    using ::charted::JsonParseErrorKind;
+    using ::charted::JsonParseResult;
 }
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+#include <string_view>
+
+// Minimal self-registering test harness; charted has no external test dependency.
+namespace charted::test
+{
+    using TestFunction = void (*)();
+
+    void Register(std::string_view name, TestFunction run);
+    void ReportFailure(const char* file, int line, std::string_view expression);
+
+    // Global heap allocations made by this process so far.
+    [[nodiscard]] std::size_t GetAllocationCount() noexcept;
+
+    // Heap allocations made while running fn repeatedly; warm-up allocations are not counted.
+    template <typename TFn>
+    [[nodiscard]] std::size_t CountAllocations(TFn&& fn, std::size_t repeat = 100)
+    {
+        fn();
+        const std::size_t before = GetAllocationCount();
+        for (std::size_t i = 0; i < repeat; ++i)
+        {
+            fn();
+        }
+        return GetAllocationCount() - before;
+    }
+
+    struct Registrar
+    {
+        Registrar(std::string_view name, TestFunction run) { Register(name, run); }
+    };
+}
+
+#define CHARTED_TEST(name)                                                          \
+    static void name();                                                             \
+    static const ::charted::test::Registrar name##Registrar(#name, &name);          \
+    static void name()
+
+#define CHARTED_CHECK(expression)                                                   \
+    ((expression) ? static_cast<void>(0)                                            \
+                  : ::charted::test::ReportFailure(__FILE__, __LINE__, #expression))
@@ -0,0 +1,130 @@
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string_view>
+#include <vector>
+
+#include "charted_json/charted_json.hpp"
+#include "charted_test.hpp"
+
+namespace
+{
+    struct TestCase
+    {
+        std::string_view           Name;
+        charted::test::TestFunction Run;
+    };
+
+    std::vector<TestCase>& GetRegistry()
+    {
+        static std::vector<TestCase> registry;
+        return registry;
+    }
+
+    // Atomic because tests may allocate from several threads.
+    std::atomic<std::size_t> g_allocation_count{ 0 };
+    std::size_t              g_failure_count = 0;
+
+    [[noreturn]] void ReportOutOfMemory()
+    {
+#if CHARTED_HAS_EXCEPTIONS
+        throw std::bad_alloc();
+#else
+        std::abort();
+#endif
+    }
+
+    void* CountedAllocate(std::size_t size)
+    {
+        g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+        if (void* memory = std::malloc(size > 0 ? size : 1))
+        {
+            return memory;
+        }
+        ReportOutOfMemory();
+    }
+
+    void* CountedAllocate(std::size_t size, std::align_val_t alignment)
+    {
+        g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+        const auto align = static_cast<std::size_t>(alignment);
+#if defined(_MSC_VER)
+        void* memory = _aligned_malloc(size > 0 ? size : 1, align);
+#else
+        // aligned_alloc requires the size to be a multiple of the alignment.
+        void* memory = std::aligned_alloc(align, ((size > 0 ? size : 1) + align - 1) / align * align);
+#endif
+        if (memory != nullptr)
+        {
+            return memory;
+        }
+        ReportOutOfMemory();
+    }
+
+    void AlignedFree(void* memory, std::align_val_t) noexcept
+    {
+#if defined(_MSC_VER)
+        _aligned_free(memory);
+#else
+        std::free(memory);
+#endif
+    }
+}
+
+// The full replaceable set, so every allocation is counted and every form is released by its matching function.
+void* operator new(std::size_t size) { return CountedAllocate(size); }
+void* operator new[](std::size_t size) { return CountedAllocate(size); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return CountedAllocate(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return CountedAllocate(size, alignment); }
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete[](void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete(void* memory, std::align_val_t alignment) noexcept { AlignedFree(memory, alignment); }
+void operator delete[](void* memory, std::align_val_t alignment) noexcept { AlignedFree(memory, alignment); }
+void operator delete(void* memory, std::size_t, std::align_val_t alignment) noexcept { AlignedFree(memory, alignment); }
+void operator delete[](void* memory, std::size_t, std::align_val_t alignment) noexcept { AlignedFree(memory, alignment); }
+
+namespace charted::test
+{
+    void Register(std::string_view name, TestFunction run)
+    {
+        GetRegistry().push_back(TestCase{ .Name = name, .Run = run });
+    }
+
+    void ReportFailure(const char* file, int line, std::string_view expression)
+    {
+        ++g_failure_count;
+        std::cout << file << ':' << line << ": check failed: " << expression << '\n';
+    }
+
+    std::size_t GetAllocationCount() noexcept
+    {
+        return g_allocation_count.load(std::memory_order_relaxed);
+    }
+}
+
+// Runs every registered test, or only those whose name contains the first argument.
+int main(int argc, char** argv)
+{
+    const std::string_view filter = (argc > 1) ? std::string_view(argv[1]) : std::string_view{};
+
+    std::size_t run = 0;
+    for (const TestCase& test : GetRegistry())
+    {
+        if (!filter.empty() && test.Name.find(filter) == std::string_view::npos)
+        {
+            continue;
+        }
+
+        const std::size_t failuresBefore = g_failure_count;
+        test.Run();
+        ++run;
+        std::cout << (g_failure_count == failuresBefore ? "[ OK ] " : "[FAIL] ") << test.Name << '\n';
+    }
+
+    std::cout << run << " tests, " << g_failure_count << " failed checks\n";
+    return (g_failure_count == 0 && run > 0) ? 0 : 1;
+}
@@ -0,0 +1,508 @@
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "charted/charted.hpp"
+#include "charted_json/charted_json.hpp"
+#include "charted_test.hpp"
+
+namespace
+{
+    // Root.Config.System.Modules[3].Pipelines[2].Stages[4].Name = "Stage-Name", plus a few siblings.
+    charted::Json MakeDocument()
+    {
+        charted::Json json;
+        json.Set(charted::route("Root.Config.System.Modules[3].Pipelines[2].Stages[4].Name"), "Stage-Name");
+        json.Set(charted::route("Root.Config.System.Modules[3].Port"), 8080);
+        json.Set(charted::route("Root.Config.System.Log.Message"), std::string(64, 'm'));
+        json.Set(charted::route("Root.Config.System.Samples"), std::vector<int>(32, 7));
+        json.Set("Flat", 123);
+        return json;
+    }
+}
+
+CHARTED_TEST(SetAndGetByKeyAndRoute)
+{
+    charted::Json json;
+    json.Set("name", "Charted");
+    json.Set(charted::route("A.B[2].C"), 42);
+    json.Set(charted::route<"A.D">(), true);
+
+    CHARTED_CHECK(json.Get<std::string>("name", "") == "Charted");
+    CHARTED_CHECK(json.Get<int>(charted::route("A.B[2].C"), -1) == 42);
+    CHARTED_CHECK(json.Get<int>(charted::route<"A.B[2].C">(), -1) == 42);
+    CHARTED_CHECK(json.Get<bool>(charted::route("A.D"), false));
+    CHARTED_CHECK(json.Get<int>(charted::route("A.B[1].C"), -1) == -1);
+    CHARTED_CHECK(json.GetNative()["A"]["B"].size() == 3);
+    CHARTED_CHECK(json.GetNative()["A"]["B"][0].is_null());
+
+    // Growing an array is one resize, and an invalid route writes nothing.
+    json.Set(charted::route("Big[100000]"), 1);
+    CHARTED_CHECK(json.GetNative()["Big"].size() == 100'001);
+    json.Set(charted::route("A..B"), 1);
+    CHARTED_CHECK(!json.GetNative()["A"].contains(""));
+}
+
+CHARTED_TEST(LookupsDoNotAllocate)
+{
+    charted::Json json = MakeDocument();
+    const std::string_view longPath = "Root.Config.System.Modules[3].Pipelines[2].Stages[4].Name";
+    const auto dynamicRoute = charted::route(longPath);
+    const auto& staticRoute = charted::route<"Root.Config.System.Modules[3].Pipelines[2].Stages[4].Name">();
+    const charted::PackedRoute  packedRoute(longPath);
+    const charted::CompactRoute compactRoute(longPath);
+    const auto bound = json.Bind(packedRoute);
+    constexpr auto stageTemplate = charted::route<"Root.Config.System.Modules[$].Pipelines[$].Stages[$].Name">();
+
+    const auto readName = [&](const auto& routeValue)
+    {
+        return charted::test::CountAllocations([&] { return json.Get<std::string_view>(routeValue, "").size(); });
+    };
+    CHARTED_CHECK(readName(dynamicRoute) == 0);
+    CHARTED_CHECK(readName(staticRoute) == 0);
+    CHARTED_CHECK(readName(packedRoute) == 0);
+    CHARTED_CHECK(readName(compactRoute) == 0);
+    CHARTED_CHECK(readName(stageTemplate(3, 2, 4)) == 0);
+    CHARTED_CHECK(charted::test::CountAllocations([&] { return bound.Get<std::string_view>("").size(); }) == 0);
+    CHARTED_CHECK(charted::test::CountAllocations([&]
+    {
+        const charted::InlineRouteView<16> view(longPath);
+        return json.Get<std::string_view>(view, "").size();
+    }) == 0);
+
+    // Short strings fit the small-string buffer, so even a copying read stays off the heap.
+    CHARTED_CHECK(charted::test::CountAllocations([&] { return json.Get<std::string>(dynamicRoute, "").size(); }) == 0);
+    CHARTED_CHECK(charted::test::CountAllocations([&] { return json.Get<int>(dynamicRoute, -1); }) == 0);
+    CHARTED_CHECK(charted::test::CountAllocations([&] { return json.Get<int>("Flat", -1); }) == 0);
+
+    const auto portRoute = charted::route("Root.Config.System.Modules[3].Port");
+    CHARTED_CHECK(charted::test::CountAllocations([&] { json.Set(portRoute, 9090); }) == 0);
+    CHARTED_CHECK(charted::test::CountAllocations([&]
+    {
+        json.Update(portRoute, [](auto& node) { node = node.template get<int>() + 1; });
+    }) == 0);
+    CHARTED_CHECK(json.Get<int>(portRoute, 0) == 9090 + 101);
+
+    const auto section = charted::route("Root.Config.System.Modules[3]");
+    CHARTED_CHECK(charted::test::CountAllocations([&] { return std::as_const(json).At(section).Get<int>("Port", 0); }) == 0);
+}
+
+CHARTED_TEST(PackedRoutesResolveLikeDynamicRoutes)
+{
+    const charted::Json json = MakeDocument();
+    for (const std::string_view path : { "Root.Config.System.Modules[3].Pipelines[2].Stages[4].Name",
+                                         "Root.Config.System.Modules[3].Port",
+                                         "Root.Config.System.Modules[99].Port",
+                                         "Root.Config.System.Modules.Port",
+                                         "Root.Config[0]",
+                                         "Root.Missing" })
+    {
+        const std::string expected = json.Get<charted::Json>(charted::route(path), charted::Json{}).Dump(false);
+        CHARTED_CHECK(json.Get<charted::Json>(charted::PackedRoute(path), charted::Json{}).Dump(false) == expected);
+        CHARTED_CHECK(json.Get<charted::Json>(charted::CompactRoute(path), charted::Json{}).Dump(false) == expected);
+    }
+}
+
+CHARTED_TEST(BoundStaticRoutesRejectOutOfRangeIndices)
+{
+    const charted::Json json = MakeDocument();
+    constexpr auto stageName = charted::route<"Root.Config.System.Modules[$].Pipelines[$].Stages[$].Name">();
+    CHARTED_CHECK(json.Get<std::string>(stageName(3, 2, 4), "") == "Stage-Name");
+    CHARTED_CHECK(json.Get<std::string>(stageName(3, 2, -1), "none") == "none");
+    CHARTED_CHECK(json.Get<std::string>(stageName(std::int64_t{ 3 } + (std::int64_t{ 1 } << 32), 2, 4), "none") == "none");
+}
+
+CHARTED_TEST(TypedReadsCheckTypeAndRange)
+{
+    charted::Json json;
+    json.Set("text", "42");
+    json.Set("big", 300);
+    json.Set("negative", -1);
+    json.Set("fraction", 3.75);
+    json.Set("flag", true);
+
+    CHARTED_CHECK(!json.TryGet<int>("text").has_value());
+    CHARTED_CHECK(json.Get<int>("text", -1) == -1);
+    CHARTED_CHECK(!json.TryGet<std::int8_t>("big").has_value());
+    CHARTED_CHECK(json.TryGet<std::int16_t>("big") == std::optional<std::int16_t>(300));
+    CHARTED_CHECK(!json.TryGet<unsigned>("negative").has_value());
+    CHARTED_CHECK(json.TryGet<int>("fraction") == std::optional<int>(3));
+    CHARTED_CHECK(json.TryGet<double>("fraction") == std::optional<double>(3.75));
+    CHARTED_CHECK(json.TryGet<bool>("flag") == std::optional<bool>(true));
+    CHARTED_CHECK(!json.TryGet<bool>("big").has_value());
+    CHARTED_CHECK(!json.TryGet<std::string>("big").has_value());
+    CHARTED_CHECK(!json.TryGet<std::vector<int>>("big").has_value());
+    CHARTED_CHECK(json.TryGet<charted::Json>("big").has_value());
+}
+
+CHARTED_TEST(TypedReadsAcceptCharacterTypes)
+{
+    charted::Json json;
+    json.Set("letter", 65);
+    json.Set("big", 300);
+    json.Set("negative", -1);
+
+    CHARTED_CHECK(json.Get<char>("letter", '?') == 'A');
+    CHARTED_CHECK(json.Get<char>("big", '?') == '?');
+    CHARTED_CHECK(json.TryGet<char8_t>("letter") == std::optional<char8_t>(u8'A'));
+    CHARTED_CHECK(!json.TryGet<char8_t>("negative").has_value());
+    CHARTED_CHECK(json.TryGet<char16_t>("big") == std::optional<char16_t>(u'\u012C'));
+    CHARTED_CHECK(!json.TryGet<char32_t>("negative").has_value());
+    CHARTED_CHECK(json.TryGet<wchar_t>("negative").has_value() == std::is_signed_v<wchar_t>);
+
+    char out = 'x';
+    CHARTED_CHECK(json.GetInto("letter", out) && out == 'A');
+    CHARTED_CHECK(!json.GetInto("big", out) && out == 'A');
+}
+
+CHARTED_TEST(DumpReplacesInvalidUtf8)
+{
+    charted::Json json;
+    json.Set("text", std::string("a\xFF" "b"));
+
+    CHARTED_CHECK(json.Dump(false) == "{\"text\":\"a\xEF\xBF\xBD" "b\"}");
+    CHARTED_CHECK(std::as_const(json).At(charted::route("text")).Dump(false) == "\"a\xEF\xBF\xBD" "b\"");
+}
+
+CHARTED_TEST(BorrowedStringsPointIntoDocument)
+{
+    const charted::Json json = MakeDocument();
+    const auto messageRoute = charted::route("Root.Config.System.Log.Message");
+
+    const std::string_view view = json.Get<std::string_view>(messageRoute, "missing");
+    const std::string* text = json.Get<const std::string*>(messageRoute, nullptr);
+    CHARTED_CHECK(text != nullptr);
+    CHARTED_CHECK(view.data() == text->data());
+    CHARTED_CHECK(view == std::string(64, 'm'));
+    CHARTED_CHECK(json.Get<std::string_view>(charted::route("Root.Config.System.Modules[3].Port"), "none") == "none");
+    CHARTED_CHECK(json.Get<const std::string*>(charted::route("Missing"), nullptr) == nullptr);
+    CHARTED_CHECK(charted::test::CountAllocations([&] { return json.Get<std::string_view>(messageRoute, "").size(); }) == 0);
+}
+
+CHARTED_TEST(GetIntoReusesCallerStorage)
+{
+    const charted::Json json = MakeDocument();
+    const auto messageRoute = charted::route("Root.Config.System.Log.Message");
+    const auto samplesRoute = charted::route("Root.Config.System.Samples");
+
+    std::string message;
+    std::vector<int> samples;
+    CHARTED_CHECK(json.GetInto(messageRoute, message));
+    CHARTED_CHECK(json.GetInto(samplesRoute, samples));
+    CHARTED_CHECK(message == std::string(64, 'm'));
+    CHARTED_CHECK(samples == std::vector<int>(32, 7));
+    CHARTED_CHECK(charted::test::CountAllocations([&]
+    {
+        return json.GetInto(messageRoute, message) && json.GetInto(samplesRoute, samples);
+    }) == 0);
+
+    // A miss or a mismatch leaves the target untouched.
+    std::string kept = "kept";
+    CHARTED_CHECK(!json.GetInto(charted::route("Missing"), kept));
+    CHARTED_CHECK(!json.GetInto(samplesRoute, kept));
+    CHARTED_CHECK(kept == "kept");
+    std::vector<std::string> strings{ "a" };
+    CHARTED_CHECK(!json.GetInto(samplesRoute, strings));
+    CHARTED_CHECK(strings == std::vector<std::string>{ "a" });
+}
+
+CHARTED_TEST(GetOrElseBuildsDefaultOnlyOnMiss)
+{
+    const charted::Json json = MakeDocument();
+    int calls = 0;
+    const auto fallback = [&]
+    {
+        ++calls;
+        return std::string("fallback");
+    };
+
+    CHARTED_CHECK(json.GetOrElse<std::string>("Flat", fallback) == "fallback");
+    CHARTED_CHECK(calls == 1);
+    CHARTED_CHECK(json.GetOrElse<int>(charted::route("Root.Config.System.Modules[3].Port"), [&] { ++calls; return 0; }) == 8080);
+    CHARTED_CHECK(calls == 1);
+    CHARTED_CHECK(json.GetOrElse<std::string>(charted::route("Missing"), fallback) == "fallback");
+    CHARTED_CHECK(calls == 2);
+}
+
+CHARTED_TEST(GetManyResolvesEveryRoute)
+{
+    charted::Json json;
+    std::vector<charted::DynamicRoute> routes;
+    for (int i = 0; i < 8; ++i)
+    {
+        routes.emplace_back("Root.Modules[3].Settings.Key" + std::to_string(i));
+        json.Set(routes.back(), i * 10);
+    }
+    routes.push_back(charted::route("Root.Modules[3].Settings.Missing"));
+    routes.push_back(charted::route("Root.Modules[4].Settings.Key0"));
+    routes.push_back(charted::route("A..B"));
+
+    std::vector<std::optional<int>> values(routes.size(), 99);
+    CHARTED_CHECK(json.GetMany(routes, values) == 8);
+    for (int i = 0; i < 8; ++i)
+    {
+        CHARTED_CHECK(values[i] == std::optional<int>(i * 10));
+    }
+    CHARTED_CHECK(!values[8].has_value() && !values[9].has_value() && !values[10].has_value());
+    CHARTED_CHECK(charted::test::CountAllocations([&] { return json.GetMany(routes, values); }) == 0);
+
+    std::tuple<std::optional<int>, std::optional<std::string>, std::optional<int>> row;
+    const auto found = json.GetMany(
+        std::forward_as_tuple(routes[2], charted::route<"Root.Modules[3].Settings.Key5">(), charted::route("Nope")), row);
+    CHARTED_CHECK(found == 1);
+    CHARTED_CHECK(std::get<0>(row) == std::optional<int>(20));
+    CHARTED_CHECK(!std::get<1>(row).has_value());
+    CHARTED_CHECK(!std::get<2>(row).has_value());
+}
+
+CHARTED_TEST(SetManyWritesInOrder)
+{
+    std::vector<charted::DynamicRoute> routes;
+    std::vector<int> values;
+    for (int i = 0; i < 4; ++i)
+    {
+        for (int k = 0; k < 3; ++k)
+        {
+            routes.emplace_back("Response.Records[" + std::to_string(i) + "].Field" + std::to_string(k));
+            values.push_back(i * 10 + k);
+        }
+    }
+    routes.push_back(charted::route("Response.Records[1].Field0"));
+    values.push_back(-1);
+
+    charted::Json json;
+    json.SetMany(routes, values);
+    CHARTED_CHECK(json.GetNative()["Response"]["Records"].size() == 4);
+    CHARTED_CHECK(json.Get<int>(charted::route("Response.Records[3].Field2"), 0) == 32);
+    CHARTED_CHECK(json.Get<int>(charted::route("Response.Records[1].Field0"), 0) == -1);
+    CHARTED_CHECK(json.Get<int>(charted::route("Response.Records[1].Field1"), 0) == 11);
+
+    // Same document as repeated Set calls.
+    charted::Json expected;
+    for (std::size_t i = 0; i < routes.size(); ++i)
+    {
+        expected.Set(routes[i], values[i]);
+    }
+    CHARTED_CHECK(json.GetNative() == expected.GetNative());
+
+    charted::Json tuple;
+    tuple.SetMany(std::forward_as_tuple(charted::route("A.Name"), charted::route<"A.Port">()),
+                  std::forward_as_tuple(std::string("svc"), 8080));
+    CHARTED_CHECK(tuple.Get<std::string>(charted::route("A.Name"), "") == "svc");
+    CHARTED_CHECK(tuple.Get<int>(charted::route("A.Port"), 0) == 8080);
+}
+
+CHARTED_TEST(SetManyMovesOnlyFromOwningRvalues)
+{
+    const std::vector<charted::DynamicRoute> routes = {
+        charted::route("A.First"), charted::route("A.Second")
+    };
+    const std::string first(40, 'a');
+    const std::string second(40, 'b');
+
+    // Views and spans refer to the caller's strings, even as prvalues: the strings must stay intact.
+    std::vector<std::string> values{ first, second };
+    charted::Json json;
+    json.SetMany(routes, std::span(values));
+    json.SetMany(routes, values | std::views::all);
+    json.SetMany(routes, values);
+    CHARTED_CHECK(values[0] == first && values[1] == second);
+    CHARTED_CHECK(json.Get<std::string>(charted::route("A.Second"), "") == second);
+
+    // An rvalue container hands its elements over.
+    const char* buffer = values[0].data();
+    json.SetMany(routes, std::move(values));
+    CHARTED_CHECK(json.Get<std::string>(charted::route("A.First"), "") == first);
+    CHARTED_CHECK(json.GetNative()["A"]["First"].get_ptr<const std::string*>()->data() == buffer);
+}
+
+CHARTED_TEST(UpdateAndGetOrInsertWalkOnce)
+{
+    charted::Json json;
+    const auto hits = charted::route("Stats.Hits");
+    for (int i = 0; i < 3; ++i)
+    {
+        CHARTED_CHECK(json.Update(hits, [](auto& node) { node = node.is_number() ? node.template get<int>() + 1 : 1; }));
+    }
+    CHARTED_CHECK(json.Get<int>(hits, 0) == 3);
+    CHARTED_CHECK(!json.Update(charted::route("A..B"), [](auto&) {}));
+    CHARTED_CHECK(!json.Update(charted::route(""), [](auto&) {}));
+
+    const auto* items = json.GetOrInsert(charted::route("Log.Items"), std::vector<int>{ 1, 2 });
+    CHARTED_CHECK(items != nullptr && items->size() == 2);
+    const auto* again = json.GetOrInsert(charted::route("Log.Items"), std::vector<int>{ 9 });
+    CHARTED_CHECK(again == items && again->size() == 2);
+    CHARTED_CHECK(json.GetOrInsert(charted::route("A[x]"), 1) == nullptr);
+}
+
+CHARTED_TEST(TakeMovesValuesOut)
+{
+    charted::Json json = MakeDocument();
+    const auto messageRoute = charted::route("Root.Config.System.Log.Message");
+
+    const auto message = json.Take<std::string>(messageRoute);
+    CHARTED_CHECK(message == std::optional<std::string>(std::string(64, 'm')));
+    CHARTED_CHECK(json.At(messageRoute).IsValid() && json.At(messageRoute).IsNull());
+
+    // A failed conversion leaves the node in place.
+    const auto portRoute = charted::route("Root.Config.System.Modules[3].Port");
+    CHARTED_CHECK(!json.Take<std::string>(portRoute).has_value());
+    CHARTED_CHECK(json.Get<int>(portRoute, 0) == 8080);
+    CHARTED_CHECK(json.Take<int>(portRoute, charted::TakeMode::Erase) == std::optional<int>(8080));
+    CHARTED_CHECK(!json.At(portRoute).IsValid());
+
+    json.Set(charted::route("List"), std::vector<int>{ 1, 2, 3 });
+    CHARTED_CHECK(json.Take<int>(charted::route("List[0]"), charted::TakeMode::Erase) == std::optional<int>(1));
+    CHARTED_CHECK(json.Get<std::vector<int>>(charted::route("List")) == (std::vector<int>{ 2, 3 }));
+    CHARTED_CHECK(!json.Take<int>(charted::route("List[5]")).has_value());
+
+    const auto modules = json.Take<charted::Json>(charted::route("Root.Config.System.Modules"), charted::TakeMode::Erase);
+    CHARTED_CHECK(modules.has_value() && modules->GetNative().size() == 4);
+    CHARTED_CHECK(!json.At(charted::route("Root.Config.System.Modules")).IsValid());
+
+    charted::Json target;
+    target.Set(charted::route("Archive.Modules"), std::move(*modules));
+    CHARTED_CHECK(target.Get<std::string>(charted::route("Archive.Modules[3].Pipelines[2].Stages[4].Name"), "") == "Stage-Name");
+}
+
+CHARTED_TEST(TryParseReportsErrorKindAndOffset)
+{
+    const auto ok = charted::Json::TryParse(R"({"a":[1,2],"b":"x"})");
+    CHARTED_CHECK(ok.IsOk());
+    CHARTED_CHECK(ok.Error.Kind == charted::JsonParseErrorKind::None);
+    CHARTED_CHECK(ok.Value->Get<int>(charted::route("a[1]"), 0) == 2);
+
+    const auto trailingComma = charted::Json::TryParse(R"({"a":1,})");
+    CHARTED_CHECK(!trailingComma.IsOk());
+    CHARTED_CHECK(trailingComma.Error.Kind == charted::JsonParseErrorKind::UnexpectedToken);
+    CHARTED_CHECK(trailingComma.Error.Offset == 7);
+
+    const auto truncated = charted::Json::TryParse(R"({"a":[1,2)");
+    CHARTED_CHECK(truncated.Error.Kind == charted::JsonParseErrorKind::UnexpectedEnd);
+    CHARTED_CHECK(truncated.Error.Offset == 9);
+
+    const auto empty = charted::Json::TryParse("");
+    CHARTED_CHECK(empty.Error.Kind == charted::JsonParseErrorKind::UnexpectedEnd);
+    CHARTED_CHECK(empty.Error.Offset == 0);
+
+    const auto badLiteral = charted::Json::TryParse(R"({"a":tru})");
+    CHARTED_CHECK(badLiteral.Error.Kind == charted::JsonParseErrorKind::InvalidToken);
+    CHARTED_CHECK(badLiteral.Error.Offset == 8);
+
+    const auto trailingData = charted::Json::TryParse(R"({"a":1} 2)");
+    CHARTED_CHECK(trailingData.Error.Kind == charted::JsonParseErrorKind::UnexpectedToken);
+    CHARTED_CHECK(trailingData.Error.Offset == 8);
+
+    using Kind = charted::JsonParseErrorKind;
+    CHARTED_CHECK(charted::Json::TryParse(R"({"a" "b"})").Error.Kind == Kind::UnexpectedToken);
+    CHARTED_CHECK(charted::Json::TryParse(R"({1:2})").Error.Kind == Kind::UnexpectedToken);
+    CHARTED_CHECK(charted::Json::TryParse(R"([true false])").Error.Kind == Kind::UnexpectedToken);
+    CHARTED_CHECK(charted::Json::TryParse(R"({"a":"abc)").Error.Kind == Kind::InvalidToken);
+    CHARTED_CHECK(charted::Json::TryParse(R"([1.])").Error.Kind == Kind::InvalidToken);
+    CHARTED_CHECK(charted::Json::TryParse(R"(["\u12"])").Error.Kind == Kind::InvalidToken);
+    CHARTED_CHECK(charted::Json::TryParse("[1e999]").Error.Kind == Kind::InvalidToken);
+    CHARTED_CHECK(charted::Json::TryParse("tru").Error.Kind == Kind::InvalidToken);
+    CHARTED_CHECK(charted::Json::TryParse("[1,").Error.Kind == Kind::UnexpectedEnd);
+    CHARTED_CHECK(charted::Json::TryParse("  ").Error.Kind == Kind::UnexpectedEnd);
+
+    // The document is built in the same pass that checks the input.
+    constexpr std::string_view nested = R"({"a":{"b":[1,-2,3.5,"x",[true,null],{}]},"a2":[],"c":"d","c":"e"})";
+    const auto parsed = charted::Json::TryParse(nested);
+    CHARTED_CHECK(parsed.IsOk() && parsed.Value->GetNative() == nlohmann::json::parse(nested));
+    CHARTED_CHECK(charted::Json::TryParse("7").Value->GetNative() == 7);
+
+    CHARTED_CHECK(!charted::Json::Parse(R"({"a":1,})").has_value());
+    CHARTED_CHECK(charted::Json::Parse(R"({"a":1})")->Get<int>("a", 0) == 1);
+}
+
+CHARTED_TEST(NodeViewsUseRelativeRoutes)
+{
+    charted::Json json = MakeDocument();
+    const auto moduleRoute = charted::route("Root.Config.System.Modules[3]");
+
+    const charted::JsonConstRef constView = std::as_const(json).At(moduleRoute);
+    CHARTED_CHECK(constView.IsValid());
+    CHARTED_CHECK(constView.Get<int>("Port", 0) == 8080);
+    CHARTED_CHECK(constView.Get<std::string>(charted::route<"Pipelines[2].Stages[4].Name">(), "") == "Stage-Name");
+    CHARTED_CHECK(constView.At(charted::route("Pipelines[2]")).At(charted::route("Stages[4]")).Get<std::string>("Name", "") == "Stage-Name");
+    CHARTED_CHECK(!std::as_const(json).At(charted::route("Root.Nope")).IsValid());
+
+    const std::uint64_t generation = json.GetGeneration();
+    charted::JsonRef view = json.At(moduleRoute);
+    view.Set("Port", 9090).Set(charted::route("Tags[1]"), "b");
+    CHARTED_CHECK(json.Get<int>(charted::route("Root.Config.System.Modules[3].Port"), 0) == 9090);
+    CHARTED_CHECK(json.Get<std::string>(charted::route("Root.Config.System.Modules[3].Tags[1]"), "") == "b");
+    CHARTED_CHECK(json.GetGeneration() != generation);
+
+    charted::JsonRef missing = json.At(charted::route("Root.Nope"));
+    missing.Set("Port", 1);
+    CHARTED_CHECK(!json.At(charted::route("Root.Nope")).IsValid());
+}
+
+CHARTED_TEST(BoundRouteReresolvesAfterMutation)
+{
+    charted::Json json = MakeDocument();
+    const auto name = json.Bind(charted::route("Root.Config.System.Modules[3].Pipelines[2].Stages[4].Name"));
+    CHARTED_CHECK(name.Get<std::string>("") == "Stage-Name");
+
+    json.Set(charted::route("Root.Config.System.Modules[3].Pipelines[2].Stages[4].Name"), "Renamed");
+    CHARTED_CHECK(name.Get<std::string>("") == "Renamed");
+
+    json.At(charted::route("Root.Config.System.Modules[3]")).Set(charted::route("Pipelines[2].Stages[4].Name"), "ViaView");
+    CHARTED_CHECK(name.Get<std::string>("") == "ViaView");
+
+    CHARTED_CHECK(json.Take<charted::Json>(charted::route("Root.Config.System.Modules"), charted::TakeMode::Erase).has_value());
+    CHARTED_CHECK(!name.Exists());
+    CHARTED_CHECK(name.Get<std::string>("gone") == "gone");
+
+    json.Set(charted::route("Root.Config.System.Modules[3].Pipelines[2].Stages[4].Name"), "Back");
+    CHARTED_CHECK(name.Get<std::string>("") == "Back");
+    json.Clear();
+    CHARTED_CHECK(!name.Exists());
+
+    json = MakeDocument();
+    CHARTED_CHECK(name.Get<std::string>("") == "Stage-Name");
+}
+
+CHARTED_TEST(CopiesStartFromFreshGeneration)
+{
+    const charted::Json json = MakeDocument();
+    const charted::Json copy = json;
+    CHARTED_CHECK(copy.GetGeneration() != json.GetGeneration());
+    CHARTED_CHECK(charted::Json(copy).GetGeneration() != copy.GetGeneration());
+    CHARTED_CHECK(copy.Get<std::string>(charted::route("Root.Config.System.Modules[3].Name"), "") ==
+                  json.Get<std::string>(charted::route("Root.Config.System.Modules[3].Name"), ""));
+
+    charted::Json target;
+    static_assert(std::is_same_v<decltype(target.GetOrInsert(charted::route("A"), 1)), const nlohmann::json*>);
+    const auto items = target.Bind(charted::route("A"));
+    CHARTED_CHECK(!items.Exists());
+    CHARTED_CHECK(target.GetOrInsert(charted::route("A"), 1) != nullptr);
+    CHARTED_CHECK(items.Get<int>(0) == 1);
+
+    // A hit stores nothing, so it leaves the generation and every bound route alone.
+    target.Set(charted::route("B.C"), 3);
+    const std::uint64_t generation = target.GetGeneration();
+    CHARTED_CHECK(target.GetOrInsert(charted::route("A"), 2) != nullptr);
+    CHARTED_CHECK(target.At(charted::route("B")).GetOrInsert(charted::route("C"), 4) != nullptr);
+    CHARTED_CHECK(target.GetGeneration() == generation && items.Get<int>(0) == 1);
+    CHARTED_CHECK(target.At(charted::route("B")).GetOrInsert(charted::route("D"), 5) != nullptr);
+    CHARTED_CHECK(target.GetGeneration() != generation);
+}
+
+CHARTED_TEST(NewDocumentsStartFromFreshGeneration)
+{
+    const charted::Json first;
+    const charted::Json second;
+    const charted::Json native(nlohmann::json::object());
+    CHARTED_CHECK(first.GetGeneration() != second.GetGeneration());
+    CHARTED_CHECK(native.GetGeneration() != first.GetGeneration());
+    CHARTED_CHECK(native.GetGeneration() != second.GetGeneration());
+}
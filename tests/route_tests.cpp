@@ -0,0 +1,668 @@
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "charted/charted.hpp"
+#include "charted_test.hpp"
+
+namespace
+{
+    // Builds route-like strings of at least minLength bytes; corrupt ones sprinkle in delimiters and junk.
+    std::vector<std::string> GenerateRoutes(std::size_t count, std::size_t minLength, bool corrupt)
+    {
+        std::mt19937 rng(20240601u);
+        constexpr std::string_view noise = ".[]x9";
+        std::vector<std::string> routes;
+        routes.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::string path;
+            while (path.size() < minLength)
+            {
+                if (!path.empty())
+                {
+                    path += '.';
+                }
+                const std::size_t keyLength = 1 + rng() % 14;
+                for (std::size_t k = 0; k < keyLength; ++k)
+                {
+                    path += static_cast<char>('a' + rng() % 26);
+                }
+                if (rng() % 3 == 0)
+                {
+                    path += '[' + std::to_string(rng() % 1000) + ']';
+                }
+            }
+            if (corrupt && !path.empty() && rng() % 2 == 0)
+            {
+                path[rng() % path.size()] = noise[rng() % noise.size()];
+            }
+            routes.push_back(std::move(path));
+        }
+        return routes;
+    }
+
+    bool SameTokens(std::span<const charted::RouteToken> lhs, std::span<const charted::RouteToken> rhs)
+    {
+        if (lhs.size() != rhs.size())
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+        {
+            if (!(lhs[i] == rhs[i]) || lhs[i].Ptr != rhs[i].Ptr)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Compares tokens parsed from copies of the same path by offset rather than by address.
+    bool SameTokensAt(std::span<const charted::RouteToken> lhs, const char* lhsBase,
+                      std::span<const charted::RouteToken> rhs, const char* rhsBase)
+    {
+        if (lhs.size() != rhs.size())
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+        {
+            if (!(lhs[i] == rhs[i]) || (lhs[i].Ptr - lhsBase) != (rhs[i].Ptr - rhsBase))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Byte-at-a-time reference parser. Every route scanner must produce identical results.
+    bool ParseRouteScalar(std::string_view path, std::vector<charted::RouteToken>& outTokens)
+    {
+        outTokens.clear();
+        constexpr std::size_t maxTokenLength = 65535;
+        std::size_t cursor = 0;
+        while (cursor < path.size())
+        {
+            if (path[cursor] == '.')
+            {
+                if ((cursor + 1) < path.size() && path[cursor + 1] == '.')
+                {
+                    outTokens.clear();
+                    return false;
+                }
+                ++cursor;
+                continue;
+            }
+
+            const std::size_t keyStart = cursor;
+            while (cursor < path.size() && path[cursor] != '.' && path[cursor] != '[')
+            {
+                ++cursor;
+            }
+
+            if (keyStart < cursor)
+            {
+                if ((cursor - keyStart) > maxTokenLength)
+                {
+                    outTokens.clear();
+                    return false;
+                }
+                outTokens.push_back(charted::RouteToken{
+                    .Ptr    = path.data() + keyStart,
+                    .Length = static_cast<std::uint16_t>(cursor - keyStart),
+                    .Type   = charted::RouteTokenType::Key,
+                    .Index  = 0
+                });
+            }
+
+            if (cursor < path.size() && path[cursor] == '[')
+            {
+                ++cursor;
+                const std::size_t indexStart = cursor;
+                while (cursor < path.size() && path[cursor] != ']')
+                {
+                    const char c = path[cursor];
+                    if (c < '0' || c > '9')
+                    {
+                        outTokens.clear();
+                        return false;
+                    }
+                    ++cursor;
+                }
+
+                if (cursor >= path.size() || indexStart == cursor)
+                {
+                    outTokens.clear();
+                    return false;
+                }
+
+                std::uint32_t index = 0;
+                for (std::size_t i = indexStart; i < cursor; ++i)
+                {
+                    index = (index * 10u) + static_cast<std::uint32_t>(path[i] - '0');
+                }
+                if ((cursor - indexStart) > maxTokenLength)
+                {
+                    outTokens.clear();
+                    return false;
+                }
+
+                outTokens.push_back(charted::RouteToken{
+                    .Ptr    = path.data() + indexStart,
+                    .Length = static_cast<std::uint16_t>(cursor - indexStart),
+                    .Type   = charted::RouteTokenType::Index,
+                    .Index  = index
+                });
+
+                ++cursor;
+            }
+
+            if (cursor < path.size() && path[cursor] == '.')
+            {
+                if ((cursor + 1) < path.size() && path[cursor + 1] == '.')
+                {
+                    outTokens.clear();
+                    return false;
+                }
+                ++cursor;
+            }
+        }
+
+        return true;
+    }
+
+    template <typename TScanner>
+    bool MatchesScalar(std::string_view path, std::span<const charted::RouteToken> expected, bool expectedValid)
+    {
+        std::vector<charted::RouteToken> tokens;
+        return charted::detail::ParseDynamicRoute<TScanner>(path, tokens) == expectedValid &&
+            SameTokens(expected, tokens);
+    }
+
+    // Checks that tokens spell out keys and indices, written as "Key" or "[N]".
+    bool HasTokens(std::span<const charted::RouteToken> tokens, std::initializer_list<std::string_view> expected)
+    {
+        if (tokens.size() != expected.size())
+        {
+            return false;
+        }
+        std::size_t i = 0;
+        for (const std::string_view segment : expected)
+        {
+            const charted::RouteToken& token = tokens[i++];
+            if (segment.front() == '[')
+            {
+                const std::string digits(segment.substr(1, segment.size() - 2));
+                if (token.Type != charted::RouteTokenType::Index || token.Index != std::stoul(digits) ||
+                    token.GetString() != digits)
+                {
+                    return false;
+                }
+            }
+            else if (token.Type != charted::RouteTokenType::Key || token.GetString() != segment)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename TIndex>
+    concept CanAppendIndex = requires(charted::RouteBuilder& builder, TIndex index) { builder /= index; };
+}
+
+CHARTED_TEST(DynamicRouteTokenizesKeysAndIndices)
+{
+    const auto routeValue = charted::route("A.B[2].C");
+    CHARTED_CHECK(routeValue.IsValid());
+    CHARTED_CHECK(routeValue.GetPathString() == "A.B[2].C");
+    CHARTED_CHECK(HasTokens(routeValue.GetTokens(), { "A", "B", "[2]", "C" }));
+
+    CHARTED_CHECK(HasTokens(charted::route("Root[0][12].Name").GetTokens(), { "Root", "[0]", "[12]", "Name" }));
+    CHARTED_CHECK(HasTokens(charted::route("A]B.C").GetTokens(), { "A]B", "C" }));
+    CHARTED_CHECK(charted::route("").IsValid());
+    CHARTED_CHECK(charted::route("").GetTokenCount() == 0);
+}
+
+CHARTED_TEST(DynamicRouteRejectsMalformedPaths)
+{
+    for (const std::string_view path : { "A..B", "A[x]", "A[", "A[]", "A[1", "A[-1]", "A[1.2]" })
+    {
+        const charted::DynamicRoute routeValue(path);
+        CHARTED_CHECK(!routeValue.IsValid());
+        CHARTED_CHECK(routeValue.GetTokenCount() == 0);
+    }
+}
+
+CHARTED_TEST(DynamicRouteCopyAndMoveKeepTokens)
+{
+    // Seven tokens: more than the inline token storage holds.
+    const charted::DynamicRoute original = charted::route("Root.Config.Modules[3].Pipelines[2].Name");
+
+    const charted::DynamicRoute copy(original);
+    CHARTED_CHECK(copy.GetPathString() == original.GetPathString());
+    CHARTED_CHECK(copy.GetPathString().data() != original.GetPathString().data());
+    CHARTED_CHECK(HasTokens(copy.GetTokens(), { "Root", "Config", "Modules", "[3]", "Pipelines", "[2]", "Name" }));
+    CHARTED_CHECK(copy.GetTokens()[0].Ptr == copy.GetPathString().data());
+
+    charted::DynamicRoute source(original);
+    const charted::DynamicRoute moved(std::move(source));
+    CHARTED_CHECK(HasTokens(moved.GetTokens(), { "Root", "Config", "Modules", "[3]", "Pipelines", "[2]", "Name" }));
+    CHARTED_CHECK(moved.GetTokens().back().Ptr == moved.GetPathString().data() + moved.GetPathString().size() - 4);
+
+    charted::DynamicRoute assigned = charted::route("X");
+    assigned = original;
+    CHARTED_CHECK(HasTokens(assigned.GetTokens(), { "Root", "Config", "Modules", "[3]", "Pipelines", "[2]", "Name" }));
+    assigned = charted::route("A[1]");
+    CHARTED_CHECK(HasTokens(assigned.GetTokens(), { "A", "[1]" }));
+    CHARTED_CHECK(assigned.GetTokens()[0].Ptr == assigned.GetPathString().data());
+
+    const charted::DynamicRoute invalid = charted::route("A..B");
+    const charted::DynamicRoute invalidCopy(invalid);
+    CHARTED_CHECK(!invalidCopy.IsValid());
+}
+
+CHARTED_TEST(DynamicRouteMoveStealsStorage)
+{
+    static_assert(std::is_nothrow_move_constructible_v<charted::DynamicRoute>);
+    static_assert(std::is_nothrow_move_assignable_v<charted::DynamicRoute>);
+
+    charted::DynamicRoute source("Root.Config.Modules[3].Pipelines[2].Stages[4].Name");
+    const charted::RouteToken* tokens = source.GetTokens().data();
+    charted::DynamicRoute moved(std::move(source));
+    CHARTED_CHECK(moved.GetTokens().data() == tokens);
+    CHARTED_CHECK(source.GetTokenCount() == 0);
+
+    // Short routes keep their tokens inline and their path in the SSO buffer; both are copied and rebased.
+    charted::DynamicRoute shortSource("A.B[1]");
+    charted::DynamicRoute shortMoved(std::move(shortSource));
+    CHARTED_CHECK(HasTokens(shortMoved.GetTokens(), { "A", "B", "[1]" }));
+    CHARTED_CHECK(shortMoved.GetTokens()[1].Ptr == shortMoved.GetPathString().data() + 2);
+
+    CHARTED_CHECK(charted::test::CountAllocations([&]
+    {
+        charted::DynamicRoute temporary(std::move(moved));
+        moved = std::move(temporary);
+        return moved.GetTokenCount();
+    }) == 0);
+}
+
+CHARTED_TEST(DynamicRouteAdoptsRvalueString)
+{
+    std::string path = "Root.Config.Modules[3].Pipelines[2].Stages[4].Name.With.A.Long.Tail";
+    const char* buffer = path.data();
+    const auto routeValue = charted::route(std::move(path));
+    CHARTED_CHECK(routeValue.GetPathString().data() == buffer);
+    CHARTED_CHECK(routeValue.GetTokenCount() == 13);
+}
+
+// The memory-resource overloads are deprecated but must keep compiling and parsing.
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4996)
+#else
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+CHARTED_TEST(DynamicRouteAcceptsDeprecatedMemoryResource)
+{
+    std::pmr::monotonic_buffer_resource resource;
+    const charted::DynamicRoute fromView(std::string_view("A.B[2]"), &resource);
+    CHARTED_CHECK(HasTokens(fromView.GetTokens(), { "A", "B", "[2]" }));
+    CHARTED_CHECK(fromView.GetMemoryResource() == std::pmr::new_delete_resource());
+
+    const charted::DynamicRoute fromString(std::string("A[1].C"), std::pmr::get_default_resource());
+    CHARTED_CHECK(HasTokens(fromString.GetTokens(), { "A", "[1]", "C" }));
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#else
+#pragma GCC diagnostic pop
+#endif
+
+CHARTED_TEST(BlockedTokenizerMatchesScalarParser)
+{
+    // Short routes sit inside one block, long ones cross many blocks and overflow DynamicRoute's token stage.
+    std::vector<std::string> paths = GenerateRoutes(20'000, 1, true);
+    for (std::string& path : GenerateRoutes(2'000, 300, true))
+    {
+        paths.push_back(std::move(path));
+    }
+
+    std::size_t checked = 0;
+    for (const std::string& path : paths)
+    {
+        std::vector<charted::RouteToken> expected;
+        const bool expectedValid = ParseRouteScalar(path, expected);
+        CHARTED_CHECK(MatchesScalar<charted::detail::DefaultRouteScanner>(path, expected, expectedValid));
+        CHARTED_CHECK(MatchesScalar<charted::detail::SwarRouteScanner>(path, expected, expectedValid));
+#if CHARTED_HAS_SSE2
+        CHARTED_CHECK(MatchesScalar<charted::detail::Sse2RouteScanner>(path, expected, expectedValid));
+#endif
+
+        const charted::DynamicRoute routeValue(path);
+        CHARTED_CHECK(routeValue.IsValid() == expectedValid);
+        CHARTED_CHECK(SameTokensAt(expected, path.data(), routeValue.GetTokens(), routeValue.GetPathString().data()));
+        ++checked;
+    }
+    CHARTED_CHECK(checked == 22'000);
+}
+
+CHARTED_TEST(RouteViewParsesIntoCallerStorage)
+{
+    std::array<charted::RouteToken, 4> storage{};
+    const charted::RouteView view("A.B[2].C", storage);
+    CHARTED_CHECK(view.IsValid());
+    CHARTED_CHECK(view.GetTokens().data() == storage.data());
+    CHARTED_CHECK(HasTokens(view.GetTokens(), { "A", "B", "[2]", "C" }));
+
+    const charted::RouteView overflow("A.B.C.D.E", storage);
+    CHARTED_CHECK(!overflow.IsValid());
+    CHARTED_CHECK(overflow.GetTokenCount() == 0);
+
+    const charted::InlineRouteView<3> inlineView("A[1].B");
+    CHARTED_CHECK(inlineView.IsValid());
+    CHARTED_CHECK(HasTokens(inlineView.GetTokens(), { "A", "[1]", "B" }));
+    CHARTED_CHECK(!charted::InlineRouteView<2>("A.B.C").IsValid());
+
+    const std::string path = "Root.Modules[3].Name";
+    CHARTED_CHECK(charted::test::CountAllocations([&] { return charted::InlineRouteView<8>(path).GetTokenCount(); }) == 0);
+}
+
+CHARTED_TEST(StaticRouteParsesAtCompileTime)
+{
+    constexpr auto routeValue = charted::route<"Root.Modules[3].Name">();
+    static_assert(routeValue.GetTokenCount() == 4);
+    static_assert(decltype(routeValue)::Parsed.Tokens.size() == 4);
+    static_assert(routeValue.GetTokens()[2].Type == charted::RouteTokenType::Index);
+    static_assert(routeValue.GetTokens()[2].Index == 3);
+    CHARTED_CHECK(HasTokens(routeValue.GetTokens(), { "Root", "Modules", "[3]", "Name" }));
+
+    const auto dynamicRoute = charted::route("Root.Modules[3].Name");
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        CHARTED_CHECK(dynamicRoute.GetTokens()[i] == routeValue.GetTokens()[i]);
+    }
+    CHARTED_CHECK(!(dynamicRoute.GetTokens()[0] == routeValue.GetTokens()[1]));
+}
+
+CHARTED_TEST(StaticRouteHolesBindRuntimeIndices)
+{
+    constexpr auto stageName = charted::route<"Modules[$].Pipelines[$].Name">();
+    static_assert(decltype(stageName)::HoleCount == 2);
+
+    const auto bound = stageName(3u, 5u);
+    CHARTED_CHECK(bound.IsValid());
+    CHARTED_CHECK(bound.GetTokenCount() == 5);
+    CHARTED_CHECK(bound.GetTokens()[1].Index == 3);
+    CHARTED_CHECK(bound.GetTokens()[3].Index == 5);
+    CHARTED_CHECK(bound.GetTokens()[4].GetString() == "Name");
+    CHARTED_CHECK(bound.GetBoundIndex<1>() == 3 && bound.GetBoundIndex<3>() == 5);
+
+    // Out-of-range indices invalidate the route instead of wrapping; bool and characters are not indices.
+    CHARTED_CHECK(stageName(3, 5).IsValid());
+    CHARTED_CHECK(!stageName(-1, 5).IsValid());
+    CHARTED_CHECK(!stageName(3, std::int64_t{ 1 } << 40).IsValid());
+    CHARTED_CHECK(stageName(std::uint64_t{ 0xFFFFFFFF }, 0).IsValid());
+    static_assert(!std::is_invocable_v<decltype(stageName), bool, int>);
+    static_assert(!std::is_invocable_v<decltype(stageName), char, int>);
+    static_assert(!std::is_invocable_v<decltype(stageName), double, int>);
+}
+
+CHARTED_TEST(PackedRouteEncodesTokensRelativeToPath)
+{
+    const charted::PackedRoute packed("Root.Modules[3].Name");
+    CHARTED_CHECK(packed.IsValid());
+    CHARTED_CHECK(packed.GetTokenCount() == 4);
+
+    const auto tokens = packed.GetTokens();
+    CHARTED_CHECK(tokens[0].GetType() == charted::RouteTokenType::Key);
+    CHARTED_CHECK(tokens[0].Offset == 0 && tokens[0].GetLength() == 4 && tokens[0].Value == 0);
+    CHARTED_CHECK(tokens[1].Offset == 5 && tokens[1].GetLength() == 7);
+    CHARTED_CHECK(tokens[2].GetType() == charted::RouteTokenType::Index && tokens[2].Value == 3);
+    CHARTED_CHECK(tokens[3].Offset == 16);
+
+    // Tokens and text share one position-independent block, so a copy is a byte-for-byte duplicate.
+    const charted::PackedRoute copy(packed);
+    CHARTED_CHECK(copy.GetPathString() == "Root.Modules[3].Name");
+    CHARTED_CHECK(copy.GetPathString().data() != packed.GetPathString().data());
+    CHARTED_CHECK(std::memcmp(copy.GetTokens().data(), tokens.data(), tokens.size_bytes()) == 0);
+    CHARTED_CHECK(copy.GetPathString().data() == reinterpret_cast<const char*>(copy.GetTokens().data() + 4));
+    CHARTED_CHECK(charted::test::CountAllocations([&] { return charted::PackedRoute(packed).GetTokenCount(); }, 1) == 1);
+
+    charted::PackedRoute source(packed);
+    const charted::PackedRoute moved(std::move(source));
+    CHARTED_CHECK(moved.GetPathString() == "Root.Modules[3].Name" && moved.GetTokenCount() == 4);
+    CHARTED_CHECK(source.GetPathString().empty() && source.GetTokenCount() == 0);
+
+    CHARTED_CHECK(!charted::PackedRoute("A..B").IsValid());
+    CHARTED_CHECK(!charted::PackedRoute(std::string(70'000, 'a')).IsValid());
+}
+
+CHARTED_TEST(CompactRouteSharesOneBlock)
+{
+    static_assert(sizeof(charted::CompactRoute) == sizeof(void*));
+
+    const charted::CompactRoute compact("Root.Modules[3].Name");
+    CHARTED_CHECK(compact.IsValid());
+    CHARTED_CHECK(compact.GetPathString() == "Root.Modules[3].Name");
+    CHARTED_CHECK(compact.GetTokenCount() == 4);
+
+    const charted::CompactRoute copy = compact;
+    CHARTED_CHECK(copy.GetPathString().data() == compact.GetPathString().data());
+    CHARTED_CHECK(charted::test::CountAllocations([&] { return charted::CompactRoute(compact).GetTokenCount(); }) == 0);
+
+    CHARTED_CHECK(!charted::CompactRoute("A[x]").IsValid());
+    CHARTED_CHECK(charted::CompactRoute("").GetTokenCount() == 0);
+}
+
+CHARTED_TEST(RouteBuilderComposesWithoutParsing)
+{
+    const auto base = charted::route("Root.Config.Modules");
+    auto name = base / 3 / "Name";
+    CHARTED_CHECK(name.GetPathString() == "Root.Config.Modules[3].Name");
+    CHARTED_CHECK(HasTokens(name.GetTokens(), { "Root", "Config", "Modules", "[3]", "Name" }));
+
+    name.Pop();
+    CHARTED_CHECK(name.GetPathString() == "Root.Config.Modules[3]");
+    name.Truncate(3);
+    CHARTED_CHECK(name.GetPathString() == "Root.Config.Modules");
+
+    name /= "bad.key";
+    CHARTED_CHECK(!name.IsValid());
+    name.Pop();
+    CHARTED_CHECK(name.IsValid());
+
+    charted::RouteBuilder copy(name);
+    copy /= 7;
+    CHARTED_CHECK(copy.GetPathString() == "Root.Config.Modules[7]");
+    CHARTED_CHECK(copy.GetTokens()[0].Ptr == copy.GetPathString().data());
+    CHARTED_CHECK(name.GetPathString() == "Root.Config.Modules");
+
+    charted::RouteBuilder reused(base);
+    reused /= 1;
+    reused /= "Name";
+    CHARTED_CHECK(charted::test::CountAllocations([&]
+    {
+        reused.Truncate(3);
+        reused /= 1;
+        reused /= "Name";
+        return reused.GetTokenCount();
+    }) == 0);
+}
+
+CHARTED_TEST(RouteBuilderAppendsItselfAndRangeChecksIndices)
+{
+    charted::RouteBuilder builder(charted::route("Key[1]"));
+    builder.Append(builder);
+    builder.Append(builder);
+    CHARTED_CHECK(builder.GetPathString() == "Key[1].Key[1].Key[1].Key[1]");
+    CHARTED_CHECK(HasTokens(builder.GetTokens(), { "Key", "[1]", "Key", "[1]", "Key", "[1]", "Key", "[1]" }));
+    CHARTED_CHECK(builder.GetTokens()[6].Ptr == builder.GetPathString().data() + 21);
+
+    const auto base = charted::route("Items");
+    CHARTED_CHECK((base / 4).IsValid());
+    CHARTED_CHECK(!(base / -1).IsValid());
+    CHARTED_CHECK(!(base / (std::int64_t{ 1 } << 32)).IsValid());
+    CHARTED_CHECK((base / std::uint64_t{ 0xFFFFFFFF }).IsValid());
+
+    charted::RouteBuilder truncated(base);
+    truncated /= -5;
+    CHARTED_CHECK(!truncated.IsValid());
+    truncated.Pop();
+    CHARTED_CHECK(truncated.IsValid());
+
+    static_assert(CanAppendIndex<int> && CanAppendIndex<std::size_t>);
+    static_assert(!CanAppendIndex<bool> && !CanAppendIndex<char> && !CanAppendIndex<double>);
+}
+
+CHARTED_TEST(RouteCacheInternsRoutes)
+{
+    charted::RouteCache cache(64, true);
+    const auto first  = cache.Get("Root.Modules[3].Name");
+    const auto second = cache.Get("Root.Modules[3].Name");
+    CHARTED_CHECK(first.get() == second.get());
+    CHARTED_CHECK(HasTokens(first->GetTokens(), { "Root", "Modules", "[3]", "Name" }));
+    CHARTED_CHECK(cache.GetMissCount() == 1);
+    CHARTED_CHECK(cache.GetHitCount() == 1);
+
+    CHARTED_CHECK(cache.Find("Root.Modules[4].Name") == nullptr);
+    CHARTED_CHECK(cache.Find("Root.Modules[3].Name").get() == first.get());
+
+    cache.Clear();
+    CHARTED_CHECK(cache.Find("Root.Modules[3].Name") == nullptr);
+    CHARTED_CHECK(first->GetPathString() == "Root.Modules[3].Name");
+}
+
+CHARTED_TEST(RouteCacheEvictsBeyondCapacity)
+{
+    charted::RouteCache cache(8);
+    std::vector<charted::RouteCache::Handle> handles;
+    for (int i = 0; i < 256; ++i)
+    {
+        handles.push_back(cache.Get("Key" + std::to_string(i)));
+    }
+
+    std::size_t cached = 0;
+    for (int i = 0; i < 256; ++i)
+    {
+        cached += cache.Find("Key" + std::to_string(i)) != nullptr ? 1 : 0;
+    }
+    CHARTED_CHECK(cached <= cache.GetCapacity());
+    CHARTED_CHECK(cached > 0);
+
+    // Evicted routes stay alive through their handles.
+    CHARTED_CHECK(handles.front()->GetPathString() == "Key0");
+    CHARTED_CHECK(handles.front()->GetTokenCount() == 1);
+}
+
+CHARTED_TEST(RouteCacheHoldsItsCapacityWithoutConflictEvictions)
+{
+    charted::RouteCache cache(4096, true);
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (int i = 0; i < 2000; ++i)
+        {
+            (void)cache.Get("Root.Group" + std::to_string(i % 16) + ".Items[" + std::to_string(i) + "].Value");
+        }
+    }
+    CHARTED_CHECK(cache.GetMissCount() == 2000);
+    CHARTED_CHECK(cache.GetHitCount() == 2000);
+    CHARTED_CHECK(cache.GetSize() == 2000);
+
+    // Past capacity the cache evicts instead of growing.
+    for (int i = 0; i < 3 * 4096; ++i)
+    {
+        (void)cache.Get("Key" + std::to_string(i));
+    }
+    std::size_t cached = 0;
+    for (int i = 0; i < 3 * 4096; ++i)
+    {
+        cached += cache.Find("Key" + std::to_string(i)) != nullptr ? 1 : 0;
+    }
+    CHARTED_CHECK(cache.GetSize() <= cache.GetCapacity());
+    CHARTED_CHECK(cached <= cache.GetSize() && cached + 1 >= cache.GetCapacity());
+}
+
+CHARTED_TEST(RouteCacheVisitsWithoutHandles)
+{
+    charted::RouteCache cache(64);
+    const auto handle = cache.Get("Root.Modules[3].Name");
+    const std::size_t tokens = cache.Visit("Root.Modules[3].Name", [&](const charted::DynamicRoute& routeValue)
+    {
+        CHARTED_CHECK(&routeValue == handle.get());
+        CHARTED_CHECK(handle.use_count() == 2);
+        return routeValue.GetTokenCount();
+    });
+    CHARTED_CHECK(tokens == 4);
+    CHARTED_CHECK(cache.Visit("A[1]", [](const charted::DynamicRoute& routeValue) { return routeValue.IsValid(); }));
+
+    // Statistics are opt-in.
+    CHARTED_CHECK(cache.GetHitCount() == 0 && cache.GetMissCount() == 0);
+}
+
+CHARTED_TEST(RouteCacheSurvivesConcurrentLookupsAndEvictions)
+{
+    // 64 paths through 16 entries keep every thread inserting and evicting while others read.
+    charted::RouteCache cache(16, true);
+    std::vector<std::string> paths;
+    for (int i = 0; i < 64; ++i)
+    {
+        paths.push_back("Root.Modules[" + std::to_string(i) + "].Name");
+    }
+
+    constexpr int threadCount = 8;
+    constexpr int lookupCount = 20'000;
+    std::atomic<int> mismatches{ 0 };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&, t]
+        {
+            std::mt19937 rng(static_cast<std::uint32_t>(t));
+            for (int i = 0; i < lookupCount; ++i)
+            {
+                const std::string& path = paths[rng() % paths.size()];
+                bool same = false;
+                if (i % 2 == 0)
+                {
+                    const auto handle = cache.Get(path);
+                    same = handle->GetPathString() == path && handle->GetTokenCount() == 4;
+                }
+                else
+                {
+                    same = cache.Visit(path, [&](const charted::DynamicRoute& routeValue)
+                    {
+                        return routeValue.GetPathString() == path && routeValue.GetTokenCount() == 4;
+                    });
+                }
+                if (const auto found = cache.Find(path); found != nullptr && found->GetPathString() != path)
+                {
+                    same = false;
+                }
+                if (t == 0 && i % 5'000 == 0)
+                {
+                    cache.Clear();
+                }
+                mismatches.fetch_add(same ? 0 : 1, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    CHARTED_CHECK(mismatches.load() == 0);
+    CHARTED_CHECK(cache.GetHitCount() + cache.GetMissCount() == std::uint64_t{ threadCount } * lookupCount);
+    CHARTED_CHECK(cache.GetSize() <= cache.GetCapacity());
+}